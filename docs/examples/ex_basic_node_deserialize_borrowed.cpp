@@ -0,0 +1,32 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main() {
+    fkyaml::node name;
+    {
+        std::string input = "name: fkYAML\n"
+                            "version: 0.3.13\n";
+
+        // the string values refer to a copy of the input shared by the deserialized nodes.
+        fkyaml::node node = fkyaml::node::deserialize_borrowed(input);
+        name = node["name"];
+    }
+
+    // the copy of the input is still alive since the `name` node refers to it.
+    std::cout << name.get_value<std::string>() << std::endl;
+
+    // the string value is copied into an owned string before it's modified.
+    name.get_value_ref<std::string&>() += " (header-only)";
+    std::cout << name.get_value<std::string>() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,38 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <functional>
+#include <iostream>
+#include <string>
+#include <fkYAML/node.hpp>
+
+int main() {
+    std::string input = "id: 1\n"
+                        "name: foo\n"
+                        "---\n"
+                        "id: 2\n"
+                        "name: bar\n"
+                        "---\n"
+                        "id: 3\n"
+                        "name: baz\n";
+
+    // deserialize YAML documents with up to 2 threads.
+    std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs_parallel(input, 2);
+    for (const auto& doc : docs) {
+        std::cout << doc["id"].get_value<int>() << ": " << doc["name"].get_value<std::string>() << std::endl;
+    }
+
+    std::cout << std::endl;
+
+    // deserialize YAML documents with a custom executor. (here, tasks are run on the calling thread.)
+    auto executor = [](std::function<void()> task) { task(); };
+    docs = fkyaml::node::deserialize_docs_parallel(input, executor, 2);
+    std::cout << docs.size() << std::endl;
+
+    return 0;
+}
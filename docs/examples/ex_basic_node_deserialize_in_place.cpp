@@ -0,0 +1,29 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <fkYAML/node.hpp>
+
+int main() {
+    // the input must outlive the deserialized node.
+    std::string input = "name: fkYAML\n"
+                        "tags: [yaml, 'header-only', \"c\\u002B\\u002B\"]\n";
+
+    fkyaml::node node = fkyaml::node::deserialize_in_place(input);
+
+    for (const auto& tag : node["tags"]) {
+        // get the string values without copying them.
+        auto view = tag.get_value<std::string_view>();
+        bool refers_to_input = input.data() <= view.data() && view.data() < input.data() + input.size();
+        std::cout << view << ": " << std::boolalpha << refers_to_input << std::endl;
+    }
+
+    return 0;
+}
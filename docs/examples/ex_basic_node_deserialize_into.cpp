@@ -0,0 +1,46 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <fkYAML/node.hpp>
+
+namespace ns {
+
+struct book {
+    std::string title;
+    int year;
+    std::vector<std::string> tags;
+};
+
+FK_YAML_DEFINE_TYPE(book, title, year, tags)
+
+} // namespace ns
+
+int main() {
+    std::string input = "- title: Robinson Crusoe\n"
+                        "  year: 1719\n"
+                        "  tags: [adventure, classic]\n"
+                        "- title: Frankenstein\n"
+                        "  year: 1818\n"
+                        "  tags: [gothic]\n";
+
+    // decode the YAML document directly into the native data objects.
+    auto books = fkyaml::node::deserialize_into<std::vector<ns::book>>(input);
+    for (const auto& book : books) {
+        std::cout << book.title << " (" << book.year << "): " << book.tags.size() << " tag(s)" << std::endl;
+    }
+
+    // inputs with node properties are decoded as well. (the YAML nodes are built internally in that case.)
+    auto scores = fkyaml::node::deserialize_into<std::map<std::string, int>>("foo: &score 1\nbar: *score\n");
+    std::cout << scores["foo"] << " " << scores["bar"] << std::endl;
+
+    return 0;
+}
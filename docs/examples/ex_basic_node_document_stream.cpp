@@ -0,0 +1,31 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <sstream>
+#include <fkYAML/node.hpp>
+
+int main() {
+    // a stream of YAML documents, e.g., log records.
+    std::istringstream iss("level: info\n"
+                           "message: started\n"
+                           "---\n"
+                           "level: warn\n"
+                           "message: low memory\n"
+                           "---\n"
+                           "level: info\n"
+                           "message: stopped\n");
+
+    // each document is read and deserialized on demand.
+    for (auto& doc : fkyaml::node::document_stream(iss)) {
+        std::cout << doc["level"].get_value_ref<std::string&>() << ": " << doc["message"].get_value_ref<std::string&>()
+                  << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,25 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <memory>
+#include <fkYAML/node.hpp>
+
+int main() {
+    // create a table shared by the documents deserialized with it.
+    auto p_table = std::make_shared<fkyaml::node::key_intern_table_type>();
+
+    fkyaml::node first = fkyaml::node::deserialize("name: foo\nid: 1\n", p_table);
+    fkyaml::node second = fkyaml::node::deserialize("name: bar\nid: 2\n", p_table);
+
+    // the keys "name" and "id" are stored only once.
+    std::cout << p_table->size() << std::endl;
+    std::cout << second["name"].get_value<std::string>() << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,30 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main() {
+    // create a basic_node object.
+    fkyaml::node n = {
+        {"foo", true},
+        {"bar", {1, 2, 3}},
+        {"baz", {{"qux", 3.14}, {"corge", nullptr}}},
+        {123, "multi\nline"}};
+    // anchors are dropped in JSON outputs.
+    n["baz"].add_anchor_name("anchor");
+
+    // serialize the basic_node object into a compact JSON string.
+    std::cout << fkyaml::node::serialize_json(n) << std::endl;
+
+    // serialize the basic_node object into the standard output with indentation.
+    fkyaml::node::serialize_json(n, std::cout, true);
+    std::cout << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,36 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+namespace ns {
+
+struct book {
+    std::string title;
+    std::string author;
+    int year;
+};
+
+// defines from_node and to_node functions for ns::book.
+FK_YAML_DEFINE_TYPE(book, title, author, year)
+
+} // namespace ns
+
+int main() {
+    fkyaml::node n = fkyaml::node::deserialize("title: Noman's Journey\nauthor: John Doe\nyear: 2023\n");
+
+    auto b = n.get_value<ns::book>();
+    std::cout << "\"" << b.title << "\" was written by " << b.author << " in " << b.year << "." << std::endl;
+
+    b.year = 2024;
+    fkyaml::node revised = b;
+    std::cout << revised << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,31 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main() {
+    fkyaml::node n = fkyaml::node::deserialize(
+        "foo: &anchor [1, 2, 3]\n"
+        "bar: *anchor\n"
+        "baz: a string value which is long enough to be allocated on the heap\n");
+
+    fkyaml::node_memory_usage usage = fkyaml::memory_usage(n);
+
+    // the estimated bytes vary with platforms and standard library implementations.
+    std::cout << std::boolalpha;
+    std::cout << "total is the sum: "
+              << (usage.total() == usage.node_bytes + usage.container_bytes + usage.string_bytes + usage.slack_bytes +
+                                       usage.metainfo_bytes + usage.anchor_table_bytes)
+              << std::endl;
+    std::cout << "anchored sequence in the anchor table: " << (usage.anchor_table_bytes > 3 * sizeof(fkyaml::node))
+              << std::endl;
+    std::cout << "string payload counted: " << (usage.string_bytes > 64) << std::endl;
+
+    return 0;
+}
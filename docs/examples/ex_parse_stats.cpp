@@ -0,0 +1,32 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#define FK_YAML_ENABLE_INSTRUMENTATION
+#include <iostream>
+#include <fkYAML/node.hpp>
+
+int main() {
+    fkyaml::set_parse_stats_callback([](const fkyaml::parse_stats& stats) {
+        std::cout << "tokens: " << stats.num_tokens << std::endl;
+        std::cout << "strings: " << stats.nodes(fkyaml::node_type::STRING) << std::endl;
+        std::cout << "integers: " << stats.nodes(fkyaml::node_type::INTEGER) << std::endl;
+        std::cout << "unescapes: " << stats.num_unescapes << std::endl;
+        std::cout << "anchor lookups: " << stats.num_anchor_lookups << std::endl;
+
+        // durations vary from run to run.
+        std::chrono::nanoseconds lexing = stats.duration(fkyaml::parse_phase::LEXING);
+        std::cout << std::boolalpha << "lexing <= total: " << (lexing <= stats.total_duration()) << std::endl;
+    });
+
+    fkyaml::node n = fkyaml::node::deserialize("foo: &anchor \"bar\\n\"\nbaz: [*anchor, 123]\n");
+
+    // stop reporting statistics.
+    fkyaml::set_parse_stats_callback(nullptr);
+
+    return 0;
+}
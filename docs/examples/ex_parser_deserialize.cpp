@@ -0,0 +1,29 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <fkYAML/node.hpp>
+
+int main() {
+    std::vector<std::string> messages = {
+        "id: 1\nname: foo\n",
+        "{\"id\": 2, \"name\": \"bar\"}",
+        "id: 3\nname: baz\n",
+    };
+
+    // the same parser object is used for all the messages.
+    fkyaml::parser parser;
+    for (const auto& message : messages) {
+        fkyaml::node n = parser.deserialize(message);
+        std::cout << n["id"].get_value<int>() << ": " << n["name"].get_value<std::string>() << std::endl;
+    }
+
+    return 0;
+}
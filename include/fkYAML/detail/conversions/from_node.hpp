@@ -19,9 +19,14 @@
 #include <fkYAML/detail/meta/node_traits.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
 #include <fkYAML/detail/meta/type_traits.hpp>
+#include <fkYAML/detail/str_view.hpp>
 #include <fkYAML/detail/types/node_t.hpp>
 #include <fkYAML/exception.hpp>
 
+#if defined(FK_YAML_HAS_CXX_17) && FK_YAML_HAS_INCLUDE(<string_view>)
+#include <string_view>
+#endif
+
 FK_YAML_DETAIL_NAMESPACE_BEGIN
 
 ///////////////////
@@ -227,6 +232,39 @@ inline void from_node(const BasicNodeType& n, FloatType& f) {
     f = static_cast<FloatType>(tmp_float);
 }
 
+/// @brief A helper to get a view of the string value of basic_node objects without copying it.
+struct external_node_string_view {
+    /// @brief Get a view of the string value of the given basic_node object.
+    /// @note The view refers to either the string owned by the node or the external characters borrowed by the node.
+    /// @tparam BasicNodeType A basic_node template instance type.
+    /// @param n A basic_node object.
+    /// @return str_view The view of the string node value.
+    template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
+    static str_view get(const BasicNodeType& n) {
+        if FK_YAML_UNLIKELY (!n.is_string()) {
+            throw type_error("The target node value type is not string type.", n.get_type());
+        }
+        return n.get_str_view();
+    }
+};
+
+/// @brief Type traits to check if T is a non-owning view type of strings.
+/// @tparam T A target type.
+template <typename T>
+struct is_string_view_type : std::false_type {};
+
+/// @brief A specialization of is_string_view_type for str_view.
+template <>
+struct is_string_view_type<str_view> : std::true_type {};
+
+#if defined(FK_YAML_HAS_CXX_17) && FK_YAML_HAS_INCLUDE(<string_view>)
+
+/// @brief A specialization of is_string_view_type for std::string_view.
+template <>
+struct is_string_view_type<std::string_view> : std::true_type {};
+
+#endif
+
 /// @brief from_node function for BasicNodeType::string_type objects.
 /// @tparam BasicNodeType A basic_node template instance type.
 /// @param n A basic_node object.
@@ -236,7 +274,23 @@ inline void from_node(const BasicNodeType& n, typename BasicNodeType::string_typ
     if FK_YAML_UNLIKELY (!n.is_string()) {
         throw type_error("The target node value type is not string type.", n.get_type());
     }
-    s = n.template get_value_ref<const typename BasicNodeType::string_type&>();
+    str_view view = external_node_string_view::get(n);
+    s.assign(view.begin(), view.end());
+}
+
+/// @brief from_node function for non-owning string view types.
+/// @note The resulting view refers to the string stored in the node (or the external characters borrowed by the
+/// node), and thus, it's valid only while the node is alive and its value is not modified.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam StringViewType A string view type. (str_view or std::string_view)
+/// @param n A basic_node object.
+/// @param s A string view object.
+template <
+    typename BasicNodeType, typename StringViewType,
+    enable_if_t<conjunction<is_basic_node<BasicNodeType>, is_string_view_type<StringViewType>>::value, int> = 0>
+inline void from_node(const BasicNodeType& n, StringViewType& s) {
+    str_view view = external_node_string_view::get(n);
+    s = StringViewType(view.data(), view.size());
 }
 
 /// @brief from_node function for compatible string type.
@@ -250,15 +304,15 @@ template <
         conjunction<
             is_basic_node<BasicNodeType>,
             negation<std::is_same<CompatibleStringType, typename BasicNodeType::string_type>>,
+            negation<is_string_view_type<CompatibleStringType>>,
             disjunction<
                 std::is_constructible<CompatibleStringType, const typename BasicNodeType::string_type&>,
                 std::is_assignable<CompatibleStringType, const typename BasicNodeType::string_type&>>>::value,
         int> = 0>
 inline void from_node(const BasicNodeType& n, CompatibleStringType& s) {
-    if FK_YAML_UNLIKELY (!n.is_string()) {
-        throw type_error("The target node value type is not string type.", n.get_type());
-    }
-    s = n.template get_value_ref<const typename BasicNodeType::string_type&>();
+    // the value is read through a view since borrowed strings cannot be referenced as string_type in constant nodes.
+    str_view view = external_node_string_view::get(n);
+    s = typename BasicNodeType::string_type(view.begin(), view.end());
 }
 
 /// @brief A function object to call from_node functions.
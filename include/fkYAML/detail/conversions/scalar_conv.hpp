@@ -15,18 +15,18 @@
 #define FK_YAML_CONVERSIONS_SCALAR_CONV_HPP
 
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 #include <limits>
+#include <type_traits>
 
 #include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/conversions/float_parser.hpp>
 #include <fkYAML/detail/meta/type_traits.hpp>
 
 #if FK_YAML_HAS_TO_CHARS
 // Prefer std::to_chars() and std::from_chars() functions if available.
 #include <charconv>
-#else
-// Fallback to legacy string conversion functions otherwise.
-#include <string> // std::stof(), std::stod(), std::stold()
 #endif
 
 FK_YAML_DETAIL_NAMESPACE_BEGIN
@@ -420,6 +420,41 @@ inline bool atob(CharItr begin, CharItr end, BoolType& boolean) noexcept {
 // scalar --> decimals
 //
 
+/// @brief Loads 8 characters into a 64-bit unsigned integer in the little-endian byte order.
+/// @note The byte order is fixed regardless of the platform so that the following SWAR (SIMD within a register)
+/// operations work everywhere.
+/// @param p_begin The pointer to the first of the 8 characters.
+/// @return uint64_t The 8 characters packed into a 64-bit unsigned integer.
+inline uint64_t load_8_chars(const char* p_begin) noexcept {
+    uint64_t chars = 0;
+    std::memcpy(&chars, p_begin, sizeof(chars));
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    chars = __builtin_bswap64(chars);
+#endif
+    return chars;
+}
+
+/// @brief Checks if all the 8 characters packed by load_8_chars() are decimal digits.
+/// @param chars The 8 characters packed into a 64-bit unsigned integer.
+/// @return true if all the 8 characters are decimal digits, false otherwise.
+inline bool is_8_decimal_digits(uint64_t chars) noexcept {
+    // The upper nibble of each byte must be 0x3, and adding 6 to the byte must not carry into it. ('9' + 6 == '?')
+    return ((chars & UINT64_C(0xF0F0F0F0F0F0F0F0)) |
+            (((chars + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) >> 4)) ==
+           UINT64_C(0x3333333333333333);
+}
+
+/// @brief Converts the 8 decimal digits packed by load_8_chars() into their value.
+/// @warning All the 8 characters must be decimal digits. Check them with is_8_decimal_digits() beforehand.
+/// @param chars The 8 decimal digits packed into a 64-bit unsigned integer.
+/// @return uint32_t The value of the 8 decimal digits, i.e., [0, 99999999].
+inline uint32_t parse_8_decimal_digits(uint64_t chars) noexcept {
+    // Combine adjacent digits into 2-digit, 4-digit and then 8-digit values with one multiplication for each step.
+    chars = ((chars & UINT64_C(0x0F0F0F0F0F0F0F0F)) * 2561) >> 8;
+    chars = ((chars & UINT64_C(0x00FF00FF00FF00FF)) * 6553601) >> 16;
+    return static_cast<uint32_t>(((chars & UINT64_C(0x0000FFFF0000FFFF)) * UINT64_C(42949672960001)) >> 32);
+}
+
 /// @brief Converts a scalar into decimals. This is common implementation for both signed/unsigned integer types.
 /// @warning
 /// This function does NOT care about overflows if IntType is unsigned. The source string value must be validated
@@ -436,16 +471,29 @@ inline bool atoi_dec_unchecked(const char* p_begin, const char* p_end, IntType&
         is_non_bool_integral<IntType>::value,
         "atoi_dec_unchecked() accepts non-boolean integral types as an output type");
 
-    i = 0;
-    do {
+    // Accumulate in the unsigned counterpart since overflow is intentional for the minimum values of signed types.
+    using unsigned_type = typename std::make_unsigned<IntType>::type;
+    unsigned_type u = 0;
+
+    // Integer types with 4 or more bytes can have 8 or more digits. Convert 8 digits at a time while possible.
+    while (sizeof(IntType) >= 4 && p_end - p_begin >= 8) {
+        uint64_t chars = load_8_chars(p_begin);
+        if FK_YAML_UNLIKELY (!is_8_decimal_digits(chars)) {
+            return false;
+        }
+        u = static_cast<unsigned_type>(u * static_cast<unsigned_type>(100000000u) + parse_8_decimal_digits(chars));
+        p_begin += 8;
+    }
+
+    for (; p_begin != p_end; ++p_begin) {
         char c = *p_begin;
         if FK_YAML_UNLIKELY (c < '0' || '9' < c) {
             return false;
         }
-        // Overflow is intentional when the IntType is signed.
-        i = i * IntType(10) + IntType(c - '0');
-    } while (++p_begin != p_end);
+        u = static_cast<unsigned_type>(u * 10u + static_cast<unsigned_type>(c - '0'));
+    }
 
+    i = static_cast<IntType>(u);
     return true;
 }
 
@@ -733,28 +781,19 @@ inline bool atof_impl(const char* p_begin, const char* p_end, FloatType& f) noex
 
 #else
 
-/// @brief Converts a scalar into a `float` value.
-/// @warning `p_begin` and `p_end` must not be null. Validate them before calling this function.
-/// @param p_begin The pointer to the first element of the scalar.
-/// @param p_end The pointer to the past-the-end element of the scalar.
-/// @param f The output `float` value holder.
-/// @return true if the conversion completes successfully, false otherwise.
-inline bool atof_impl(const char* p_begin, const char* p_end, float& f) {
-    std::size_t idx = 0;
-    f = std::stof(std::string(p_begin, p_end), &idx);
-    return idx == static_cast<std::size_t>(p_end - p_begin);
-}
-
-/// @brief Converts a scalar into a `double` value.
+/// @brief Converts a scalar into a floating point value.
+/// @note This is a locale-independent and allocation-free fallback of std::from_chars(), which produces the same
+/// results. See float_parser.hpp for details.
 /// @warning `p_begin` and `p_end` must not be null. Validate them before calling this function.
 /// @param p_begin The pointer to the first element of the scalar.
 /// @param p_end The pointer to the past-the-end element of the scalar.
-/// @param f The output `double` value holder.
+/// @param f The output floating point value holder.
 /// @return true if the conversion completes successfully, false otherwise.
-inline bool atof_impl(const char* p_begin, const char* p_end, double& f) {
-    std::size_t idx = 0;
-    f = std::stod(std::string(p_begin, p_end), &idx);
-    return idx == static_cast<std::size_t>(p_end - p_begin);
+template <typename FloatType>
+inline bool atof_impl(const char* p_begin, const char* p_end, FloatType& f) noexcept {
+    static_assert(
+        std::is_floating_point<FloatType>::value, "atof_impl() accepts floating point types as an output type");
+    return parse_float(p_begin, p_end, f);
 }
 
 #endif // FK_YAML_HAS_TO_CHARS
@@ -767,7 +806,7 @@ inline bool atof_impl(const char* p_begin, const char* p_end, double& f) {
 /// @param f The output floating point value holder.
 /// @return true if the conversion completes successfully, false otherwise.
 template <typename CharItr, typename FloatType>
-inline bool atof(CharItr begin, CharItr end, FloatType& f) noexcept(noexcept(atof_impl(&*begin, &*begin, f))) {
+inline bool atof(CharItr begin, CharItr end, FloatType& f) noexcept {
     static_assert(is_iterator_of<CharItr, char>::value, "atof() accepts iterators for char type");
     static_assert(std::is_floating_point<FloatType>::value, "atof() accepts floating point types as an output type");
 
@@ -817,19 +856,7 @@ inline bool atof(CharItr begin, CharItr end, FloatType& f) noexcept(noexcept(ato
         }
     }
 
-#if FK_YAML_HAS_TO_CHARS
     return atof_impl(p_begin, p_end, f);
-#else
-    bool success = false;
-    try {
-        success = atof_impl(p_begin, p_end, f);
-    }
-    catch (const std::exception& /*unused*/) {
-        success = false;
-    }
-
-    return success;
-#endif
 }
 
 FK_YAML_DETAIL_NAMESPACE_END
@@ -0,0 +1,141 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_CONVERSIONS_STRUCT_BINDER_HPP
+#define FK_YAML_DETAIL_CONVERSIONS_STRUCT_BINDER_HPP
+
+#include <cstring>
+#include <utility>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/str_view.hpp>
+#include <fkYAML/exception.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief Check if a mapping key is equal to a field name.
+/// @note Since the field name is a string literal, the comparisons on its length and first character are resolved at
+/// compile time and most keys are dispatched without calling memcmp().
+/// @tparam N The size of the field name including the null character.
+/// @param key The contents of a mapping key.
+/// @param name The field name.
+/// @return true if the key is equal to the field name, false otherwise.
+template <std::size_t N>
+inline bool is_field_name(str_view key, const char (&name)[N]) noexcept {
+    // field names are never empty since they are C++ identifiers.
+    return key.size() == N - 1 && key[0] == name[0] && std::memcmp(key.data() + 1, name + 1, N - 2) == 0;
+}
+
+/// @brief A helper to bind entries of a mapping node to fields of a struct in a single pass.
+/// @note This is used by the functions generated with the FK_YAML_DEFINE_TYPE macro.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class struct_binder {
+    static_assert(is_basic_node<BasicNodeType>::value, "struct_binder only accepts basic_node<...>");
+
+    /** A type for mapping node values. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+
+public:
+    /// @brief Construct a new struct_binder object for the given node.
+    /// @param n A basic_node object to be bound to a struct. It must be a mapping node.
+    explicit struct_binder(const BasicNodeType& n)
+        : m_mapping(get_mapping(n)) {
+    }
+
+    /// @brief Get the mapping node value to be bound.
+    /// @return const mapping_type& The mapping node value.
+    const mapping_type& mapping() const noexcept {
+        return m_mapping;
+    }
+
+    /// @brief Get the contents of a mapping key if it's a string node.
+    /// @param key A mapping key node.
+    /// @param out The contents of the mapping key.
+    /// @return true if the key is a string node, false otherwise.
+    static bool get_key(const BasicNodeType& key, str_view& out) {
+        if FK_YAML_UNLIKELY (!key.is_string()) {
+            return false;
+        }
+        out = key.template get_value<str_view>();
+        return true;
+    }
+
+    /// @brief Convert the mapping value into the field if the key matches the field name.
+    /// @tparam N The size of the field name including the null character.
+    /// @tparam FieldType The type of the field.
+    /// @param key The contents of a mapping key.
+    /// @param name The field name.
+    /// @param value The mapping value associated with the key.
+    /// @param field The field to be assigned.
+    /// @return true if the key matches the field name, false otherwise.
+    template <std::size_t N, typename FieldType>
+    bool bind(str_view key, const char (&name)[N], const BasicNodeType& value, FieldType& field) {
+        if (!is_field_name(key, name)) {
+            return false;
+        }
+        field = value.template get_value<FieldType>();
+        ++m_num_bound_fields;
+        return true;
+    }
+
+    /// @brief Get the number of fields which have been bound so far.
+    /// @return std::size_t The number of bound fields.
+    std::size_t num_bound_fields() const noexcept {
+        return m_num_bound_fields;
+    }
+
+    /// @brief Check if the mapping has a key for the field.
+    /// @tparam N The size of the field name including the null character.
+    /// @param name The field name.
+    template <std::size_t N>
+    void require(const char (&name)[N]) const {
+        str_view key {};
+        for (const auto& pair : m_mapping) {
+            if (get_key(pair.first, key) && is_field_name(key, name)) {
+                return;
+            }
+        }
+        throw out_of_range(name);
+    }
+
+    /// @brief Store the field into the mapping node value with the field name as its key.
+    /// @tparam N The size of the field name including the null character.
+    /// @tparam FieldType The type of the field.
+    /// @param m The mapping node value to store the field into.
+    /// @param name The field name.
+    /// @param field The field to be stored.
+    template <std::size_t N, typename FieldType>
+    static void store(mapping_type& m, const char (&name)[N], const FieldType& field) {
+        m.emplace(BasicNodeType(string_type(name, N - 1)), BasicNodeType(field));
+    }
+
+private:
+    /// @brief Get the mapping node value of the given node.
+    /// @param n A basic_node object.
+    /// @return const mapping_type& The mapping node value.
+    static const mapping_type& get_mapping(const BasicNodeType& n) {
+        if FK_YAML_UNLIKELY (!n.is_mapping()) {
+            throw type_error("The target node value type is not mapping type.", n.get_type());
+        }
+        return n.template get_value_ref<const mapping_type&>();
+    }
+
+private:
+    /// The mapping node value to be bound.
+    const mapping_type& m_mapping;
+    /// The number of fields which have been bound so far.
+    std::size_t m_num_bound_fields {0};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_CONVERSIONS_STRUCT_BINDER_HPP */
@@ -9,6 +9,7 @@
 #ifndef FK_YAML_DETAIL_CONVERSIONS_TO_NODE_HPP
 #define FK_YAML_DETAIL_CONVERSIONS_TO_NODE_HPP
 
+#include <cstdint>
 #include <utility>
 
 #include <fkYAML/detail/macros/version_macros.hpp>
@@ -16,6 +17,7 @@
 #include <fkYAML/detail/meta/type_traits.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
 #include <fkYAML/detail/node_attrs.hpp>
+#include <fkYAML/detail/str_view.hpp>
 #include <fkYAML/node_type.hpp>
 
 FK_YAML_DETAIL_NAMESPACE_BEGIN
@@ -42,7 +44,7 @@ struct external_node_constructor<node_type::SEQUENCE> {
     /// @param s A lvalue sequence value.
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, const typename BasicNodeType::sequence_type& s) noexcept {
-        n.m_node_value.destroy(n.m_attrs & detail::node_attr_mask::value);
+        n.m_node_value.destroy(n.m_attrs);
         n.m_attrs = detail::node_attr_bits::seq_bit;
         n.m_node_value.p_sequence = BasicNodeType::template create_object<typename BasicNodeType::sequence_type>(s);
     }
@@ -53,7 +55,7 @@ struct external_node_constructor<node_type::SEQUENCE> {
     /// @param s A rvalue sequence value.
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::sequence_type&& s) noexcept {
-        n.m_node_value.destroy(n.m_attrs & detail::node_attr_mask::value);
+        n.m_node_value.destroy(n.m_attrs);
         n.m_attrs = detail::node_attr_bits::seq_bit;
         n.m_node_value.p_sequence =
             BasicNodeType::template create_object<typename BasicNodeType::sequence_type>(std::move(s));
@@ -69,7 +71,7 @@ struct external_node_constructor<node_type::MAPPING> {
     /// @param m A lvalue mapping value.
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, const typename BasicNodeType::mapping_type& m) noexcept {
-        n.m_node_value.destroy(n.m_attrs & detail::node_attr_mask::value);
+        n.m_node_value.destroy(n.m_attrs);
         n.m_attrs = detail::node_attr_bits::map_bit;
         n.m_node_value.p_mapping = BasicNodeType::template create_object<typename BasicNodeType::mapping_type>(m);
     }
@@ -80,7 +82,7 @@ struct external_node_constructor<node_type::MAPPING> {
     /// @param m A rvalue mapping value.
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::mapping_type&& m) noexcept {
-        n.m_node_value.destroy(n.m_attrs & detail::node_attr_mask::value);
+        n.m_node_value.destroy(n.m_attrs);
         n.m_attrs = detail::node_attr_bits::map_bit;
         n.m_node_value.p_mapping =
             BasicNodeType::template create_object<typename BasicNodeType::mapping_type>(std::move(m));
@@ -96,7 +98,7 @@ struct external_node_constructor<node_type::NULL_OBJECT> {
     /// @param (unused) nullptr
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, std::nullptr_t /*unused*/) noexcept {
-        n.m_node_value.destroy(n.m_attrs & detail::node_attr_mask::value);
+        n.m_node_value.destroy(n.m_attrs);
         n.m_attrs = detail::node_attr_bits::null_bit;
         n.m_node_value.p_mapping = nullptr;
     }
@@ -111,7 +113,7 @@ struct external_node_constructor<node_type::BOOLEAN> {
     /// @param b A boolean value.
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::boolean_type b) noexcept {
-        n.m_node_value.destroy(n.m_attrs & detail::node_attr_mask::value);
+        n.m_node_value.destroy(n.m_attrs);
         n.m_attrs = detail::node_attr_bits::bool_bit;
         n.m_node_value.boolean = b;
     }
@@ -126,7 +128,7 @@ struct external_node_constructor<node_type::INTEGER> {
     /// @param i An integer value.
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::integer_type i) noexcept {
-        n.m_node_value.destroy(n.m_attrs & detail::node_attr_mask::value);
+        n.m_node_value.destroy(n.m_attrs);
         n.m_attrs = detail::node_attr_bits::int_bit;
         n.m_node_value.integer = i;
     }
@@ -141,7 +143,7 @@ struct external_node_constructor<node_type::FLOAT> {
     /// @param f A floating point number.
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::float_number_type f) noexcept {
-        n.m_node_value.destroy(n.m_attrs & detail::node_attr_mask::value);
+        n.m_node_value.destroy(n.m_attrs);
         n.m_attrs = detail::node_attr_bits::float_bit;
         n.m_node_value.float_val = f;
     }
@@ -156,7 +158,7 @@ struct external_node_constructor<node_type::STRING> {
     /// @param s A constant lvalue string.
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, const typename BasicNodeType::string_type& s) noexcept {
-        n.m_node_value.destroy(n.m_attrs & detail::node_attr_mask::value);
+        n.m_node_value.destroy(n.m_attrs);
         n.m_attrs = detail::node_attr_bits::string_bit;
         n.m_node_value.p_string = BasicNodeType::template create_object<typename BasicNodeType::string_type>(s);
     }
@@ -167,7 +169,7 @@ struct external_node_constructor<node_type::STRING> {
     /// @param s A rvalue string.
     template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
     static void construct(BasicNodeType& n, typename BasicNodeType::string_type&& s) noexcept {
-        n.m_node_value.destroy(n.m_attrs & detail::node_attr_mask::value);
+        n.m_node_value.destroy(n.m_attrs);
         n.m_attrs = detail::node_attr_bits::string_bit;
         n.m_node_value.p_string =
             BasicNodeType::template create_object<typename BasicNodeType::string_type>(std::move(s));
@@ -186,10 +188,24 @@ struct external_node_constructor<node_type::STRING> {
                 negation<std::is_same<typename BasicNodeType::string_type, CompatibleStringType>>>::value,
             int> = 0>
     static void construct(BasicNodeType& n, const CompatibleStringType& s) noexcept {
-        n.m_node_value.destroy(n.m_attrs & detail::node_attr_mask::value);
+        n.m_node_value.destroy(n.m_attrs);
         n.m_attrs = detail::node_attr_bits::string_bit;
         n.m_node_value.p_string = BasicNodeType::template create_object<typename BasicNodeType::string_type>(s);
     }
+
+    /// @brief Constructs a basic_node object which refers to the given characters without copying them.
+    /// @warning The characters must outlive the basic_node object and its copies. The size of the characters must
+    /// not exceed the maximum value of uint32_t.
+    /// @tparam BasicNodeType A basic_node template instance type.
+    /// @param n A basic_node object.
+    /// @param s The characters to be borrowed.
+    template <typename BasicNodeType, enable_if_t<is_basic_node<BasicNodeType>::value, int> = 0>
+    static void construct_borrowed(BasicNodeType& n, str_view s) noexcept {
+        n.m_node_value.destroy(n.m_attrs);
+        n.m_attrs = detail::node_attr_bits::string_bit | detail::node_attr_bits::borrowed_str_bit;
+        n.m_node_value.p_borrowed_str = s.data();
+        n.m_borrowed_str_size = static_cast<uint32_t>(s.size());
+    }
 };
 
 /////////////////
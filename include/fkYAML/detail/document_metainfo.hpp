@@ -11,8 +11,10 @@
 
 #include <string>
 #include <map>
+#include <memory>
 
 #include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/input/key_intern_table.hpp>
 #include <fkYAML/detail/meta/node_traits.hpp>
 #include <fkYAML/yaml_version_type.hpp>
 
@@ -33,6 +35,10 @@ struct document_metainfo {
     std::map<std::string /*handle*/, std::string /*prefix*/> named_handle_map {};
     /// The map of anchor node which allows for key duplication.
     std::multimap<std::string /*anchor name*/, BasicNodeType> anchor_table {};
+    /// The copy of the input which borrowed string nodes in the YAML document refer to. (maybe null)
+    std::shared_ptr<const std::string> p_input_buffer {};
+    /// The table of interned mapping key strings which key nodes in the YAML document refer to. (maybe null)
+    std::shared_ptr<const key_intern_table> p_key_table {};
 };
 
 FK_YAML_DETAIL_NAMESPACE_END
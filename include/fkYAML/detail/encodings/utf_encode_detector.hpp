@@ -9,8 +9,12 @@
 #ifndef FK_YAML_DETAIL_ENCODINGS_UTF_ENCODE_DETECTOR_HPP
 #define FK_YAML_DETAIL_ENCODINGS_UTF_ENCODE_DETECTOR_HPP
 
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <cstdio>
 #include <istream>
+#include <string>
 
 #include <fkYAML/detail/macros/version_macros.hpp>
 #include <fkYAML/detail/encodings/utf_encode_t.hpp>
@@ -81,6 +85,23 @@ inline utf_encode_t detect_encoding_type(const std::array<uint8_t, 4>& bytes, bo
     return utf_encode_t::UTF_8;
 }
 
+/// @brief Get the size of the BOM for the encoding type.
+/// @param encode_type An encoding type.
+/// @return std::size_t The size of the BOM in bytes.
+inline std::size_t get_bom_size(utf_encode_t encode_type) noexcept {
+    switch (encode_type) {
+    case utf_encode_t::UTF_8:
+        return 3;
+    case utf_encode_t::UTF_16BE:
+    case utf_encode_t::UTF_16LE:
+        return 2;
+    case utf_encode_t::UTF_32BE:
+    case utf_encode_t::UTF_32LE:
+    default:
+        return 4;
+    }
+}
+
 /// @brief A class which detects UTF encoding type and the existence of a BOM at the beginning.
 /// @tparam ItrType Type of iterators for the input.
 template <typename ItrType, typename = void>
@@ -282,6 +303,33 @@ struct file_utf_encode_detector {
 
         return encode_type;
     }
+
+    /// @brief Detects the encoding type of the input without seeking the file, and consumes a BOM if it exists.
+    /// @note Unlike detect(std::FILE*), this function works with non-seekable files such as pipes as well.
+    /// @param p_file The input file handle.
+    /// @param leading_bytes The storage for the bytes which have been read for the detection, excluding a BOM.
+    /// @return A detected encoding type.
+    static utf_encode_t detect(std::FILE* p_file, std::string& leading_bytes) {
+        std::array<uint8_t, 4> bytes {};
+        bytes.fill(0xFFu);
+        std::size_t read_size = 0;
+        for (; read_size < 4; read_size++) {
+            char byte = 0;
+            std::size_t size = std::fread(&byte, sizeof(char), 1, p_file);
+            if (size != sizeof(char)) {
+                break;
+            }
+            bytes[read_size] = uint8_t(byte & 0xFF);
+        }
+
+        bool has_bom = false;
+        utf_encode_t encode_type = detect_encoding_type(bytes, has_bom);
+
+        std::size_t bom_size = has_bom ? std::min(get_bom_size(encode_type), read_size) : 0;
+        leading_bytes.assign(reinterpret_cast<const char*>(bytes.data()) + bom_size, read_size - bom_size);
+
+        return encode_type;
+    }
 };
 
 /// @brief A class which detects UTF encoding type and the existence of a BOM from the input file.
@@ -328,6 +376,32 @@ struct stream_utf_encode_detector {
 
         return encode_type;
     }
+
+    /// @brief Detects the encoding type of the input without seeking the stream, and consumes a BOM if it exists.
+    /// @note Unlike detect(std::istream&), this function works with non-seekable streams such as pipes as well.
+    /// @param is The input stream.
+    /// @param leading_bytes The storage for the bytes which have been read for the detection, excluding a BOM.
+    /// @return A detected encoding type.
+    static utf_encode_t detect(std::istream& is, std::string& leading_bytes) {
+        std::array<uint8_t, 4> bytes {};
+        bytes.fill(0xFFu);
+        std::size_t read_size = 0;
+        for (; read_size < 4; read_size++) {
+            char ch = 0;
+            if (!is.get(ch)) {
+                break;
+            }
+            bytes[read_size] = uint8_t(ch & 0xFF);
+        }
+
+        bool has_bom = false;
+        utf_encode_t encode_type = detect_encoding_type(bytes, has_bom);
+
+        std::size_t bom_size = has_bom ? std::min(get_bom_size(encode_type), read_size) : 0;
+        leading_bytes.assign(reinterpret_cast<const char*>(bytes.data()) + bom_size, read_size - bom_size);
+
+        return encode_type;
+    }
 };
 
 FK_YAML_DETAIL_NAMESPACE_END
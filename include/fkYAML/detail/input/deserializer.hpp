@@ -10,17 +10,29 @@
 #define FK_YAML_DETAIL_INPUT_DESERIALIZER_HPP
 
 #include <algorithm>
-#include <deque>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 #include <fkYAML/detail/macros/version_macros.hpp>
 #include <fkYAML/detail/document_metainfo.hpp>
+#include <fkYAML/detail/input/document_boundary_scanner.hpp>
+#include <fkYAML/detail/input/flow_entry_counter.hpp>
+#include <fkYAML/detail/input/json_subset_parser.hpp>
+#include <fkYAML/detail/input/key_intern_table.hpp>
 #include <fkYAML/detail/input/lexical_analyzer.hpp>
 #include <fkYAML/detail/input/scalar_parser.hpp>
 #include <fkYAML/detail/input/tag_resolver.hpp>
+#include <fkYAML/detail/input/typed_decoder.hpp>
+#include <fkYAML/detail/instrumentation.hpp>
 #include <fkYAML/detail/meta/input_adapter_traits.hpp>
 #include <fkYAML/detail/meta/node_traits.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/meta/type_traits.hpp>
 #include <fkYAML/detail/node_attrs.hpp>
 #include <fkYAML/detail/node_property.hpp>
 #include <fkYAML/detail/types/lexical_token_t.hpp>
@@ -34,6 +46,10 @@ template <typename BasicNodeType>
 class basic_deserializer {
     static_assert(is_basic_node<BasicNodeType>::value, "basic_deserializer only accepts basic_node<...>");
 
+    /** A friend class to deserialize each part of the input. */
+    template <typename, typename>
+    friend class basic_document_stream;
+
     /** A type for the target basic_node. */
     using basic_node_type = BasicNodeType;
     /** A type for the lexical analyzer. */
@@ -44,10 +60,14 @@ class basic_deserializer {
     using tag_resolver_type = tag_resolver<basic_node_type>;
     /** A type for the scalar parser. */
     using scalar_parser_type = scalar_parser<basic_node_type>;
+    /** A type for the parser for the JSON subset of YAML. */
+    using json_parser_type = json_subset_parser<basic_node_type>;
     /** A type for sequence node value containers. */
     using sequence_type = typename basic_node_type::sequence_type;
     /** A type for mapping node value containers. */
     using mapping_type = typename basic_node_type::mapping_type;
+    /** A type for string node values. */
+    using string_type = typename basic_node_type::string_type;
 
     /// @brief Definition of state types of parse contexts.
     enum class context_state_t {
@@ -79,6 +99,21 @@ class basic_deserializer {
               p_node(_p_node) {
         }
 
+        // a parse_context object may own a heap-allocated key node, so it can only be move-constructed.
+        parse_context(const parse_context&) = delete;
+        parse_context& operator=(const parse_context&) = delete;
+        parse_context& operator=(parse_context&&) = delete;
+
+        /// @brief Move constructor of the parse_context class.
+        /// @param other A parse_context object to be moved from. It no longer refers to the associated node.
+        parse_context(parse_context&& other) noexcept
+            : line(other.line),
+              indent(other.indent),
+              state(other.state),
+              p_node(other.p_node) {
+            other.p_node = nullptr;
+        }
+
         ~parse_context() {
             switch (state) {
             case context_state_t::BLOCK_MAPPING_EXPLICIT_KEY:
@@ -113,6 +148,14 @@ public:
     basic_deserializer() = default;
 
 public:
+    /// @brief Set the table to intern mapping key strings into.
+    /// @note Interned key nodes refer to the strings in the table, which is kept alive by the resulting nodes. If the
+    /// same table is shared among deserializations, they must not run concurrently since the table isn't thread-safe.
+    /// @param p_key_table A table of interned mapping key strings. If null, mapping keys are not interned.
+    void set_key_intern_table(std::shared_ptr<key_intern_table> p_key_table) noexcept {
+        mp_key_table = std::move(p_key_table);
+    }
+
     /// @brief Deserialize a single YAML document into a YAML node.
     /// @note
     /// If the input consists of multiple YAML documents, this function only parses the first.
@@ -123,11 +166,70 @@ public:
     /// @return basic_node_type A root YAML node deserialized from the source string.
     template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
     basic_node_type deserialize(InputAdapterType&& input_adapter) {
+        FK_YAML_INSTRUMENT_SESSION();
+
+        return deserialize_impl(input_adapter.get_buffer_view());
+    }
+
+    /// @brief Deserialize a single YAML document into a YAML node whose string values may refer to the input.
+    /// @note
+    /// String scalars which need no mutation, e.g., plain scalars or quoted ones without escapes, are not copied but
+    /// refer to the input buffer if the input adapter doesn't normalize the input into its own buffer. Thus, the input
+    /// buffer must outlive the resulting nodes and their copies.
+    /// @tparam InputAdapterType The type of an input adapter object.
+    /// @param input_adapter An input adapter object for the input source buffer.
+    /// @return basic_node_type A root YAML node deserialized from the source string.
+    template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
+    basic_node_type deserialize_in_place(InputAdapterType&& input_adapter) {
+        FK_YAML_INSTRUMENT_SESSION();
+
         str_view input_view = input_adapter.get_buffer_view();
-        lexer_type lexer(input_view);
+        return deserialize_impl(input_view, input_adapter.refers_to_input());
+    }
 
-        lexical_token_t type {lexical_token_t::END_OF_BUFFER};
-        return deserialize_document(lexer, type);
+    /// @brief Deserialize a single YAML document into a YAML node whose string values may refer to a copy of the input.
+    /// @note
+    /// The input is copied once into a buffer which is shared by the resulting nodes, and then, string scalars which
+    /// need no mutation refer to the buffer just like `deserialize_in_place()`. Thus, memory allocations for string
+    /// scalars are saved without any lifetime requirements on the input.
+    /// @tparam InputAdapterType The type of an input adapter object.
+    /// @param input_adapter An input adapter object for the input source buffer.
+    /// @return basic_node_type A root YAML node deserialized from the source string.
+    template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
+    basic_node_type deserialize_borrowed(InputAdapterType&& input_adapter) {
+        FK_YAML_INSTRUMENT_SESSION();
+
+        str_view input_view = input_adapter.get_buffer_view();
+        std::shared_ptr<const std::string> p_input_buffer =
+            std::make_shared<const std::string>(input_view.begin(), input_view.end());
+        str_view buffer_view(*p_input_buffer);
+        basic_node_type root = deserialize_impl(buffer_view, true, std::move(p_input_buffer));
+
+        // the copy is owned by the resulting nodes from now on.
+        mp_input_buffer.reset();
+        return root;
+    }
+
+    /// @brief Deserialize a single YAML document directly into a native data object.
+    /// @note
+    /// The input is first decoded without building YAML nodes. If it cannot be decoded that way, e.g., it contains
+    /// anchors or tags or has errors, it's deserialized into YAML nodes and then converted into the target type, so the
+    /// result and the errors are the same as those of `deserialize()` followed by `get_value<T>()`.
+    /// @tparam T The target value type.
+    /// @tparam InputAdapterType The type of an input adapter object.
+    /// @param input_adapter An input adapter object for the input source buffer.
+    /// @return T A native data object decoded from the source string.
+    template <typename T, typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
+    T deserialize_into(InputAdapterType&& input_adapter) {
+        FK_YAML_INSTRUMENT_SESSION();
+
+        str_view input_view = input_adapter.get_buffer_view();
+
+        T value {};
+        if (typed_decoder<basic_node_type>().decode(input_view, value)) {
+            return value;
+        }
+        return deserialize_impl(input_view).template get_value<T>();
     }
 
     /// @brief Deserialize multiple YAML documents into YAML nodes.
@@ -136,20 +238,168 @@ public:
     /// @return std::vector<basic_node_type> Root YAML nodes for deserialized YAML documents.
     template <typename InputAdapterType, enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
     std::vector<basic_node_type> deserialize_docs(InputAdapterType&& input_adapter) {
+        FK_YAML_INSTRUMENT_SESSION();
+
+        return deserialize_docs_impl(input_adapter.get_buffer_view());
+    }
+
+    /// @brief Deserialize multiple YAML documents into YAML nodes in parallel.
+    /// @note The input is split into documents first, and then the documents are deserialized by the given number of
+    /// tasks which are run by the executor. If any document fails to be deserialized, the whole input is deserialized
+    /// again sequentially so that the error is reported just as the `deserialize_docs()` function does.
+    /// @tparam InputAdapterType The type of an adapter object.
+    /// @tparam ExecutorType The type of an executor which accepts `std::function<void()>` tasks.
+    /// @param input_adapter An input adapter object for the input source buffer.
+    /// @param executor An executor object which runs the given tasks, possibly in parallel.
+    /// @param max_tasks The maximum number of tasks to be passed to the executor.
+    /// @return std::vector<basic_node_type> Root YAML nodes for deserialized YAML documents in the original order.
+    template <
+        typename InputAdapterType, typename ExecutorType,
+        enable_if_t<is_input_adapter<InputAdapterType>::value, int> = 0>
+    std::vector<basic_node_type> deserialize_docs_parallel(
+        InputAdapterType&& input_adapter, ExecutorType&& executor, std::size_t max_tasks) {
+        FK_YAML_INSTRUMENT_SESSION();
+
         str_view input_view = input_adapter.get_buffer_view();
+
+        std::vector<str_view> doc_views = document_boundary_scanner::split(input_view);
+        std::size_t num_docs = doc_views.size();
+        std::size_t num_tasks = std::min(max_tasks, num_docs);
+        if (num_tasks <= 1) {
+            return deserialize_docs_impl(input_view);
+        }
+
+        std::vector<std::vector<basic_node_type>> results(num_docs);
+        std::atomic<std::size_t> next_doc_idx {0};
+        std::atomic<bool> has_failed {false};
+        std::mutex mtx;
+        std::condition_variable cv;
+        std::size_t finished_tasks = 0;
+
+        std::function<void()> task = [&]() {
+            basic_deserializer deserializer {};
+            for (;;) {
+                std::size_t idx = next_doc_idx.fetch_add(1);
+                if (idx >= num_docs || has_failed.load()) {
+                    break;
+                }
+
+                try {
+                    results[idx] = deserializer.deserialize_docs_impl(doc_views[idx]);
+                }
+                catch (...) {
+                    has_failed.store(true);
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mtx);
+            ++finished_tasks;
+            cv.notify_all();
+        };
+
+        std::size_t submitted_tasks = 0;
+        auto wait_for_tasks = [&]() {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [&]() { return finished_tasks == submitted_tasks; });
+        };
+
+        try {
+            for (; submitted_tasks < num_tasks; ++submitted_tasks) {
+                executor(task);
+            }
+        }
+        catch (...) {
+            // the submitted tasks refer to the local variables and must be finished before leaving this function.
+            has_failed.store(true);
+            wait_for_tasks();
+            throw;
+        }
+        wait_for_tasks();
+
+        if (has_failed.load()) {
+            return deserialize_docs_impl(input_view);
+        }
+
+        std::vector<basic_node_type> nodes {};
+        for (auto& docs : results) {
+            for (auto& doc : docs) {
+                nodes.emplace_back(std::move(doc));
+            }
+        }
+        return nodes;
+    }
+
+private:
+    /// @brief Deserialize the first YAML document in the input buffer into a YAML node.
+    /// @param input_view The input buffer.
+    /// @param borrows_strings Whether string nodes may refer to the input buffer instead of owning copies of it.
+    /// @param p_input_buffer The owner of the input buffer to be kept alive by the resulting nodes. (maybe null)
+    /// @return basic_node_type A root YAML node deserialized from the first YAML document.
+    basic_node_type deserialize_impl(
+        str_view input_view, bool borrows_strings = false, std::shared_ptr<const std::string> p_input_buffer = {}) {
+        m_borrows_strings = borrows_strings;
+        mp_input_buffer = std::move(p_input_buffer);
+
+        if (json_parser_type::is_candidate(input_view)) {
+            basic_node_type json_root;
+            if (try_deserialize_json(input_view, json_root)) {
+                FK_YAML_INSTRUMENT_NODES(json_root);
+                return json_root;
+            }
+        }
+
         lexer_type lexer(input_view);
 
+        lexical_token_t type {lexical_token_t::END_OF_BUFFER};
+        basic_node_type root = deserialize_document(lexer, type);
+        FK_YAML_INSTRUMENT_NODES(root);
+        return root;
+    }
+
+    /// @brief Deserialize multiple YAML documents in the input buffer into YAML nodes.
+    /// @param input_view The input buffer.
+    /// @param first_line The line number of the beginning of the input buffer, which is used in error messages.
+    /// @return std::vector<basic_node_type> Root YAML nodes for deserialized YAML documents.
+    std::vector<basic_node_type> deserialize_docs_impl(str_view input_view, uint32_t first_line = 0) {
+        m_borrows_strings = false;
+        mp_input_buffer.reset();
+
         std::vector<basic_node_type> nodes {};
+        if (json_parser_type::is_candidate(input_view)) {
+            basic_node_type json_root;
+            if (try_deserialize_json(input_view, json_root, first_line)) {
+                FK_YAML_INSTRUMENT_NODES(json_root);
+                nodes.emplace_back(std::move(json_root));
+                return nodes;
+            }
+        }
+
+        lexer_type lexer(input_view, first_line);
         lexical_token_t type {lexical_token_t::END_OF_BUFFER};
 
         do {
             nodes.emplace_back(deserialize_document(lexer, type));
+            FK_YAML_INSTRUMENT_NODES(nodes.back());
         } while (type != lexical_token_t::END_OF_BUFFER);
 
         return nodes;
     } // LCOV_EXCL_LINE
 
-private:
+    /// @brief Try deserializing the whole input with the parser for the JSON subset of YAML.
+    /// @note Since JSON inputs need no indentation or context bookkeeping, they can be parsed much faster than generic
+    /// YAML inputs. If the input leaves the JSON subset, this function fails and the input must be deserialized again
+    /// with the full YAML deserializer.
+    /// @param input_view The input buffer, which must be a candidate for JSON texts. (See is_candidate())
+    /// @param root The storage for the resulting root node.
+    /// @param first_line The line number of the beginning of the input buffer, which is used in error messages.
+    /// @return true if the input is deserialized successfully, false otherwise.
+    bool try_deserialize_json(str_view input_view, basic_node_type& root, uint32_t first_line = 0) {
+        root.mp_meta->p_input_buffer = mp_input_buffer;
+        root.mp_meta->p_key_table = mp_key_table;
+        m_json_parser.set_options(m_borrows_strings, mp_key_table.get());
+        return m_json_parser.parse(input_view, root, first_line);
+    }
+
     /// @brief Deserialize a YAML document into a YAML node.
     /// @param lexer The lexical analyzer to be used.
     /// @param last_type The variable to store the last lexical token type.
@@ -157,8 +407,13 @@ private:
     basic_node_type deserialize_document(lexer_type& lexer, lexical_token_t& last_type) {
         lexical_token token {};
 
+        // the previous call may have been aborted by an exception.
+        reset_document_states();
+
         basic_node_type root;
         mp_meta = root.mp_meta;
+        mp_meta->p_input_buffer = mp_input_buffer;
+        mp_meta->p_key_table = mp_key_table;
 
         // parse directives first.
         deserialize_directives(lexer, token);
@@ -170,7 +425,7 @@ private:
 
         switch (token.type) {
         case lexical_token_t::SEQUENCE_BLOCK_PREFIX: {
-            root = basic_node_type::sequence();
+            root = create_node(node_type::SEQUENCE);
             apply_directive_set(root);
             if (found_props) {
                 // If node properties are found before the block sequence entry prefix, the properties belong to the
@@ -186,9 +441,10 @@ private:
         case lexical_token_t::SEQUENCE_FLOW_BEGIN:
             ++m_flow_context_depth;
             lexer.set_context_state(true);
-            root = basic_node_type::sequence();
+            root = create_node(node_type::SEQUENCE);
             apply_directive_set(root);
             apply_node_properties(root);
+            reserve_flow_entries(lexer, root);
             m_context_stack.emplace_back(
                 lexer.get_lines_processed(), lexer.get_last_token_begin_pos(), context_state_t::FLOW_SEQUENCE, &root);
             token = lexer.get_next_token();
@@ -196,9 +452,10 @@ private:
         case lexical_token_t::MAPPING_FLOW_BEGIN:
             ++m_flow_context_depth;
             lexer.set_context_state(true);
-            root = basic_node_type::mapping();
+            root = create_node(node_type::MAPPING);
             apply_directive_set(root);
             apply_node_properties(root);
+            reserve_flow_entries(lexer, root);
             m_context_stack.emplace_back(
                 lexer.get_lines_processed(), lexer.get_last_token_begin_pos(), context_state_t::FLOW_MAPPING, &root);
             token = lexer.get_next_token();
@@ -207,7 +464,7 @@ private:
             // If the explicit key prefix (? ) is detected here, the root node of current document must be a mapping.
             // Also, tag and anchor if any are associated to the root mapping node.
             // No get_next_token() call here to handle the token event in the deserialize_node() function.
-            root = basic_node_type::mapping();
+            root = create_node(node_type::MAPPING);
             apply_directive_set(root);
             apply_node_properties(root);
             parse_context context(
@@ -256,6 +513,14 @@ private:
             last_type == lexical_token_t::END_OF_DOCUMENT);
 
         // reset parameters for the next call.
+        reset_document_states();
+
+        return root;
+    }
+
+    /// @brief Reset the states for deserializing a YAML document.
+    /// @note The internal buffers keep their capacity so that this object can be reused without reallocations.
+    void reset_document_states() noexcept {
         mp_current_node = nullptr;
         mp_meta.reset();
         m_needs_tag_impl = false;
@@ -263,8 +528,10 @@ private:
         m_flow_context_depth = 0;
         m_flow_token_state = flow_token_state_t::NEEDS_VALUE_OR_SUFFIX;
         m_context_stack.clear();
-
-        return root;
+        m_anchor_name.clear();
+        m_tag_name.clear();
+        m_root_anchor_name.clear();
+        m_root_tag_name.clear();
     }
 
     /// @brief Deserializes the YAML directives if specified.
@@ -400,20 +667,20 @@ private:
                     //   : bar
                     // : baz
                     // ```
-                    *mp_current_node = basic_node_type::mapping();
+                    *mp_current_node = create_node(node_type::MAPPING);
                     apply_directive_set(*mp_current_node);
                 }
 
                 if (m_context_stack.back().state == context_state_t::BLOCK_SEQUENCE) {
                     sequence_type& seq = mp_current_node->template get_value_ref<sequence_type&>();
-                    seq.emplace_back(basic_node_type::mapping());
+                    seq.emplace_back(create_node(node_type::MAPPING));
                     m_context_stack.emplace_back(line, indent, context_state_t::BLOCK_MAPPING, &(seq.back()));
                 }
 
                 token = lexer.get_next_token();
                 if (token.type == lexical_token_t::SEQUENCE_BLOCK_PREFIX) {
                     // heap-allocated node will be freed in handling the corresponding KEY_SEPARATOR event
-                    basic_node_type* p_node = new basic_node_type(node_type::SEQUENCE);
+                    basic_node_type* p_node = new basic_node_type(create_node(node_type::SEQUENCE));
                     m_context_stack.emplace_back(line, indent, context_state_t::BLOCK_MAPPING_EXPLICIT_KEY, p_node);
                     mp_current_node = m_context_stack.back().p_node;
                     apply_directive_set(*mp_current_node);
@@ -428,7 +695,7 @@ private:
 
                 // heap-allocated node will be freed in handling the corresponding KEY_SEPARATOR event
                 m_context_stack.emplace_back(
-                    line, indent, context_state_t::BLOCK_MAPPING_EXPLICIT_KEY, new basic_node_type());
+                    line, indent, context_state_t::BLOCK_MAPPING_EXPLICIT_KEY, new basic_node_type(create_node()));
                 mp_current_node = m_context_stack.back().p_node;
                 apply_directive_set(*mp_current_node);
                 indent = lexer.get_last_token_begin_pos();
@@ -483,7 +750,7 @@ private:
                             //   ^
                             //   this !!str tag overwrites the preceding !!map tag.
                             // ```
-                            *mp_current_node = basic_node_type::mapping();
+                            *mp_current_node = create_node(node_type::MAPPING);
                             apply_directive_set(*mp_current_node);
                             apply_node_properties(*mp_current_node);
                             m_context_stack.emplace_back(line, indent, context_state_t::BLOCK_MAPPING, mp_current_node);
@@ -493,7 +760,7 @@ private:
 
                     if (token.type == lexical_token_t::SEQUENCE_BLOCK_PREFIX) {
                         // a key separator preceding block sequence entries
-                        *mp_current_node = basic_node_type::sequence();
+                        *mp_current_node = create_node(node_type::SEQUENCE);
                         apply_directive_set(*mp_current_node);
                         apply_node_properties(*mp_current_node);
                         auto& cur_context = m_context_stack.back();
@@ -525,9 +792,9 @@ private:
                             // https://github.com/fktn-k/fkYAML/issues/368 for more details.
                             line = line_after_props;
                             indent = lexer.get_last_token_begin_pos();
-                            mp_current_node->template get_value_ref<sequence_type&>().emplace_back(
-                                basic_node_type::mapping());
-                            mp_current_node = &mp_current_node->template get_value_ref<sequence_type&>().back();
+                            sequence_type& seq = mp_current_node->template get_value_ref<sequence_type&>();
+                            seq.emplace_back(create_node(node_type::MAPPING));
+                            mp_current_node = &seq.back();
                             m_context_stack.emplace_back(
                                 line_after_props, indent, context_state_t::BLOCK_MAPPING, mp_current_node);
                             apply_node_properties(*mp_current_node);
@@ -549,14 +816,14 @@ private:
 
                 basic_node_type key_node = std::move(*m_context_stack.back().p_node);
                 m_context_stack.pop_back();
-                m_context_stack.back().p_node->template get_value_ref<mapping_type&>().emplace(
-                    key_node, basic_node_type());
-                mp_current_node = &(m_context_stack.back().p_node->operator[](std::move(key_node)));
+                auto itr = m_context_stack.back().p_node->template get_value_ref<mapping_type&>().emplace(
+                    std::move(key_node), create_node());
+                mp_current_node = &(itr.first->second);
                 m_context_stack.emplace_back(
                     line, indent, context_state_t::BLOCK_MAPPING_EXPLICIT_VALUE, mp_current_node);
 
                 if (token.type == lexical_token_t::SEQUENCE_BLOCK_PREFIX) {
-                    *mp_current_node = basic_node_type::sequence();
+                    *mp_current_node = create_node(node_type::SEQUENCE);
                     apply_directive_set(*mp_current_node);
                     apply_node_properties(*mp_current_node);
                     m_context_stack.emplace_back(line, indent, context_state_t::BLOCK_SEQUENCE, mp_current_node);
@@ -581,8 +848,9 @@ private:
             case lexical_token_t::SEQUENCE_BLOCK_PREFIX: {
                 bool is_further_nested = m_context_stack.back().indent < indent;
                 if (is_further_nested) {
-                    mp_current_node->template get_value_ref<sequence_type&>().emplace_back(basic_node_type::sequence());
-                    mp_current_node = &(mp_current_node->template get_value_ref<sequence_type&>().back());
+                    sequence_type& seq = mp_current_node->template get_value_ref<sequence_type&>();
+                    seq.emplace_back(create_node(node_type::SEQUENCE));
+                    mp_current_node = &seq.back();
                     m_context_stack.emplace_back(line, indent, context_state_t::BLOCK_SEQUENCE, mp_current_node);
                     apply_directive_set(*mp_current_node);
                     apply_node_properties(*mp_current_node);
@@ -646,7 +914,8 @@ private:
                 switch (m_context_stack.back().state) {
                 case context_state_t::BLOCK_SEQUENCE:
                 case context_state_t::FLOW_SEQUENCE:
-                    mp_current_node->template get_value_ref<sequence_type&>().emplace_back(basic_node_type::sequence());
+                    mp_current_node->template get_value_ref<sequence_type&>().emplace_back(
+                        create_node(node_type::SEQUENCE));
                     mp_current_node = &(mp_current_node->template get_value_ref<sequence_type&>().back());
                     m_context_stack.emplace_back(line, indent, context_state_t::FLOW_SEQUENCE, mp_current_node);
                     break;
@@ -654,11 +923,14 @@ private:
                 case context_state_t::FLOW_MAPPING:
                     // heap-allocated node will be freed in handling the corresponding SEQUENCE_FLOW_END event.
                     m_context_stack.emplace_back(
-                        line, indent, context_state_t::FLOW_SEQUENCE_KEY, new basic_node_type(node_type::SEQUENCE));
+                        line,
+                        indent,
+                        context_state_t::FLOW_SEQUENCE_KEY,
+                        new basic_node_type(create_node(node_type::SEQUENCE)));
                     mp_current_node = m_context_stack.back().p_node;
                     break;
                 default: {
-                    *mp_current_node = basic_node_type::sequence();
+                    *mp_current_node = create_node(node_type::SEQUENCE);
                     parse_context& last_context = m_context_stack.back();
                     last_context.line = line;
                     last_context.indent = indent;
@@ -669,6 +941,7 @@ private:
 
                 apply_directive_set(*mp_current_node);
                 apply_node_properties(*mp_current_node);
+                reserve_flow_entries(lexer, *mp_current_node);
 
                 m_flow_token_state = flow_token_state_t::NEEDS_VALUE_OR_SUFFIX;
                 break;
@@ -722,7 +995,7 @@ private:
 
                 token = lexer.get_next_token();
                 if (token.type == lexical_token_t::KEY_SEPARATOR) {
-                    basic_node_type key_node = basic_node_type::mapping();
+                    basic_node_type key_node = create_node(node_type::MAPPING);
                     apply_directive_set(key_node);
                     mp_current_node->swap(key_node);
 
@@ -793,7 +1066,8 @@ private:
                 switch (m_context_stack.back().state) {
                 case context_state_t::BLOCK_SEQUENCE:
                 case context_state_t::FLOW_SEQUENCE:
-                    mp_current_node->template get_value_ref<sequence_type&>().emplace_back(basic_node_type::mapping());
+                    mp_current_node->template get_value_ref<sequence_type&>().emplace_back(
+                        create_node(node_type::MAPPING));
                     mp_current_node = &(mp_current_node->template get_value_ref<sequence_type&>().back());
                     m_context_stack.emplace_back(line, indent, context_state_t::FLOW_MAPPING, mp_current_node);
                     break;
@@ -801,11 +1075,14 @@ private:
                 case context_state_t::FLOW_MAPPING:
                     // heap-allocated node will be freed in handling the corresponding MAPPING_FLOW_END event.
                     m_context_stack.emplace_back(
-                        line, indent, context_state_t::FLOW_MAPPING_KEY, new basic_node_type(node_type::MAPPING));
+                        line,
+                        indent,
+                        context_state_t::FLOW_MAPPING_KEY,
+                        new basic_node_type(create_node(node_type::MAPPING)));
                     mp_current_node = m_context_stack.back().p_node;
                     break;
                 default: {
-                    *mp_current_node = basic_node_type::mapping();
+                    *mp_current_node = create_node(node_type::MAPPING);
                     parse_context& last_context = m_context_stack.back();
                     last_context.line = line;
                     last_context.indent = indent;
@@ -816,6 +1093,7 @@ private:
 
                 apply_directive_set(*mp_current_node);
                 apply_node_properties(*mp_current_node);
+                reserve_flow_entries(lexer, *mp_current_node);
 
                 line = lexer.get_lines_processed();
                 indent = lexer.get_last_token_begin_pos();
@@ -872,7 +1150,7 @@ private:
 
                 token = lexer.get_next_token();
                 if (token.type == lexical_token_t::KEY_SEPARATOR) {
-                    basic_node_type key_node = basic_node_type::mapping();
+                    basic_node_type key_node = create_node(node_type::MAPPING);
                     apply_directive_set(key_node);
                     mp_current_node->swap(key_node);
 
@@ -906,17 +1184,22 @@ private:
                     throw parse_error("Tag cannot be specified to an alias node", line, indent);
                 }
 
-                const std::string token_str = std::string(token.str.begin(), token.str.end());
+                basic_node_type node = create_node();
+                {
+                    FK_YAML_INSTRUMENT_PHASE(ANCHOR_HANDLING);
+                    FK_YAML_INSTRUMENT_COUNT(num_anchor_lookups, 1);
 
-                uint32_t anchor_counts = static_cast<uint32_t>(mp_meta->anchor_table.count(token_str));
-                if FK_YAML_UNLIKELY (anchor_counts == 0) {
-                    throw parse_error("The given anchor name must appear prior to the alias node.", line, indent);
-                }
+                    const std::string token_str = std::string(token.str.begin(), token.str.end());
+
+                    uint32_t anchor_counts = static_cast<uint32_t>(mp_meta->anchor_table.count(token_str));
+                    if FK_YAML_UNLIKELY (anchor_counts == 0) {
+                        throw parse_error("The given anchor name must appear prior to the alias node.", line, indent);
+                    }
 
-                basic_node_type node {};
-                node.m_attrs |= detail::node_attr_bits::alias_bit;
-                node.m_prop.anchor = std::move(token_str);
-                detail::node_attr_bits::set_anchor_offset(anchor_counts - 1, node.m_attrs);
+                    node.m_attrs |= detail::node_attr_bits::alias_bit;
+                    node.m_prop.anchor = std::move(token_str);
+                    detail::node_attr_bits::set_anchor_offset(anchor_counts - 1, node.m_attrs);
+                }
 
                 apply_directive_set(node);
                 apply_node_properties(node);
@@ -935,7 +1218,10 @@ private:
                     tag_type = tag_resolver_type::resolve_tag(m_tag_name, mp_meta);
                 }
 
-                basic_node_type node = scalar_parser_type(line, indent).parse_flow(token.type, tag_type, token.str);
+                // while mapping keys are interned, scalars refer to the input buffer until they turn out to be keys.
+                bool borrows_strings = m_borrows_strings || (mp_key_table && !m_needs_anchor_impl);
+                scalar_parser_type scalar_parser(line, indent, borrows_strings, mp_meta);
+                basic_node_type node = scalar_parser.parse_flow(token.type, tag_type, token.str);
                 apply_directive_set(node);
                 apply_node_properties(node);
 
@@ -953,7 +1239,7 @@ private:
                 }
 
                 basic_node_type node =
-                    scalar_parser_type(line, indent)
+                    scalar_parser_type(line, indent, m_borrows_strings, mp_meta)
                         .parse_block(token.type, tag_type, token.str, lexer.get_block_scalar_header());
                 apply_directive_set(node);
                 apply_node_properties(node);
@@ -1088,20 +1374,23 @@ private:
         }
 
         if (mp_current_node->is_sequence()) {
-            mp_current_node->template get_value_ref<sequence_type&>().emplace_back(basic_node_type::mapping());
-            mp_current_node = &(mp_current_node->operator[](mp_current_node->size() - 1));
+            sequence_type& seq = mp_current_node->template get_value_ref<sequence_type&>();
+            seq.emplace_back(create_node(node_type::MAPPING));
+            mp_current_node = &seq.back();
             m_context_stack.emplace_back(line, indent, context_state_t::BLOCK_MAPPING, mp_current_node);
         }
 
-        auto itr = mp_current_node->template get_value_ref<mapping_type&>().emplace(std::move(key), basic_node_type());
+        intern_key(key);
+        auto itr = mp_current_node->template get_value_ref<mapping_type&>().emplace(std::move(key), create_node());
         if FK_YAML_UNLIKELY (!itr.second) {
             throw parse_error("Detected duplication in mapping keys.", line, indent);
         }
 
         mp_current_node = &(itr.first->second);
-        parse_context& key_context = m_context_stack.back();
-        m_context_stack.emplace_back(
-            key_context.line, key_context.indent, context_state_t::MAPPING_VALUE, mp_current_node);
+        // copy the position first since the stack storage may be reallocated on the following push.
+        uint32_t key_line = m_context_stack.back().line;
+        uint32_t key_indent = m_context_stack.back().indent;
+        m_context_stack.emplace_back(key_line, key_indent, context_state_t::MAPPING_VALUE, mp_current_node);
     }
 
     /// @brief Assign node value to the current node.
@@ -1162,6 +1451,7 @@ private:
                 //   : bar
                 // # ^ this separator
                 // ```
+                settle_string(node);
                 assign_node_value(std::move(node), line, indent);
                 if (m_context_stack.back().state != context_state_t::BLOCK_MAPPING_EXPLICIT_KEY) {
                     mp_current_node = m_context_stack.back().p_node;
@@ -1190,18 +1480,19 @@ private:
                         break;
                     }
 
-                    *mp_current_node = basic_node_type::mapping();
+                    *mp_current_node = create_node(node_type::MAPPING);
                     apply_directive_set(*mp_current_node);
                 }
                 else {
                     // root mapping node
 
                     m_context_stack.emplace_back(line, indent, context_state_t::BLOCK_MAPPING, mp_current_node);
-                    *mp_current_node = basic_node_type::mapping();
+                    *mp_current_node = create_node(node_type::MAPPING);
                     apply_directive_set(*mp_current_node);
 
                     // apply node properties if any to the root mapping node.
                     if (!m_root_anchor_name.empty()) {
+                        FK_YAML_INSTRUMENT_PHASE(ANCHOR_HANDLING);
                         mp_current_node->add_anchor_name(std::move(m_root_anchor_name));
                         m_root_anchor_name.clear();
                     }
@@ -1214,6 +1505,7 @@ private:
             add_new_key(std::move(node), line, indent);
         }
         else {
+            settle_string(node);
             assign_node_value(std::move(node), line, indent);
         }
         indent = lexer.get_last_token_begin_pos();
@@ -1221,16 +1513,86 @@ private:
         return true;
     }
 
+    /// @brief Replace the string value of a mapping key node with the interned one if mapping keys are interned.
+    /// @param key A mapping key node.
+    void intern_key(basic_node_type& key) {
+        bool is_internable = mp_key_table && (key.m_attrs & node_attr_mask::anchoring) == 0 && key.is_string();
+        if (is_internable) {
+            str_view interned {};
+            if FK_YAML_LIKELY (mp_key_table->intern(key.template get_value<str_view>(), interned)) {
+                external_node_constructor<node_type::STRING>::construct_borrowed(key, interned);
+                return;
+            }
+        }
+        settle_string(key);
+    }
+
+    /// @brief Make a string node own its value if it refers to the input buffer only while mapping keys are interned.
+    /// @param node A scalar node.
+    void settle_string(basic_node_type& node) {
+        if (!m_borrows_strings && (node.m_attrs & node_attr_bits::borrowed_str_bit)) {
+            node.template get_value_ref<string_type&>();
+        }
+    }
+
+    /// @brief Reserve the container of a flow collection node which has just begun for its entries.
+    /// @note Entries of an outermost flow collection and the nested ones are pre-counted at once when it begins so that
+    /// large flow collections don't suffer from repeated reallocations.
+    /// @param lexer The lexical analyzer to be used. Its last token must be the beginning of the flow collection.
+    /// @param node The flow collection node.
+    void reserve_flow_entries(const lexer_type& lexer, basic_node_type& node) {
+        if (m_flow_context_depth == 1) {
+            m_flow_entry_counter.count(lexer.get_unprocessed_input());
+        }
+
+        uint32_t num_entries = m_flow_entry_counter.next();
+        if (num_entries == 0) {
+            return;
+        }
+
+        if (node.is_sequence()) {
+            sequence_type& seq = node.template get_value_ref<sequence_type&>();
+            reserve_container(seq, num_entries, has_reserve<sequence_type> {});
+        }
+        else {
+            mapping_type& map = node.template get_value_ref<mapping_type&>();
+            reserve_container(map, num_entries, has_reserve<mapping_type> {});
+        }
+    }
+
+    /// @brief Reserve the given container for the given number of elements.
+    /// @tparam ContainerType The type of the container.
+    /// @param c A container which has reserve() member function.
+    /// @param n The number of elements.
+    template <typename ContainerType>
+    static void reserve_container(ContainerType& c, uint32_t n, std::true_type /*unused*/) {
+        c.reserve(n);
+    }
+
+    /// @brief Do nothing for containers without reserve() member function, e.g., std::map.
+    /// @tparam ContainerType The type of the container.
+    template <typename ContainerType>
+    static void reserve_container(ContainerType& /*unused*/, uint32_t /*unused*/, std::false_type /*unused*/) {
+    }
+
     /// @brief Set YAML directive properties to the given node.
     /// @param node A basic_node_type object to be set YAML directive properties.
     void apply_directive_set(basic_node_type& node) noexcept {
         node.mp_meta = mp_meta;
     }
 
+    /// @brief Create a node of the given type which shares the metainfo of the current document.
+    /// @param type A YAML node type.
+    /// @return basic_node_type The created node.
+    basic_node_type create_node(node_type type = node_type::NULL_OBJECT) const {
+        return basic_node_type(type, mp_meta);
+    }
+
     /// @brief Set YAML node properties (anchor and/or tag names) to the given node.
     /// @param node A node type object to be set YAML node properties.
     void apply_node_properties(basic_node_type& node) {
         if (m_needs_anchor_impl) {
+            FK_YAML_INSTRUMENT_PHASE(ANCHOR_HANDLING);
             node.add_anchor_name(m_anchor_name);
             m_needs_anchor_impl = false;
             m_anchor_name.clear();
@@ -1253,11 +1615,21 @@ private:
     /// The currently focused YAML node.
     basic_node_type* mp_current_node {nullptr};
     /// The stack of parse contexts.
-    std::deque<parse_context> m_context_stack {};
+    std::vector<parse_context> m_context_stack {};
     /// The current depth of flow contexts.
     uint32_t m_flow_context_depth {0};
+    /// The pre-counter of flow collection entries.
+    flow_entry_counter m_flow_entry_counter {};
+    /// The parser for inputs in the JSON subset of YAML.
+    json_parser_type m_json_parser {};
     /// The set of YAML directives.
     std::shared_ptr<doc_metainfo_type> mp_meta {};
+    /// Whether string nodes may refer to the input buffer.
+    bool m_borrows_strings {false};
+    /// The owner of the input buffer to be kept alive by the resulting nodes. (maybe null)
+    std::shared_ptr<const std::string> mp_input_buffer {};
+    /// The table to intern mapping key strings into. (maybe null)
+    std::shared_ptr<key_intern_table> mp_key_table {};
     /// A flag to determine the need for YAML anchor node implementation.
     bool m_needs_anchor_impl {false};
     /// A flag to determine the need for a corresponding node with the last YAML tag.
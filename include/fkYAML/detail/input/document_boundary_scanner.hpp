@@ -0,0 +1,301 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_DOCUMENT_BOUNDARY_SCANNER_HPP
+#define FK_YAML_DETAIL_INPUT_DOCUMENT_BOUNDARY_SCANNER_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/str_view.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief Definition of document boundary types found in a line.
+enum class document_boundary_t : std::uint8_t {
+    NONE,       //!< The line belongs to the current document.
+    BEFORE,     //!< The line begins a new document.
+    END_MARKER, //!< The line is a document end marker (...) which separates documents.
+};
+
+/// @brief A line-based scanner which finds boundaries between YAML documents without tokenizing them.
+/// @note A boundary is reported only where the lexical analyzer would end a document as well, i.e., at a directives
+/// end marker (---) which follows document contents or at a document end marker (...). Directives are kept together
+/// with the document they belong to, and block scalar contents are never split even if they contain lines which look
+/// like document markers. Some document markers (e.g., the ones followed by contents on the same line) may not be
+/// reported, so each part must still be deserialized as a sequence of YAML documents.
+class document_boundary_scanner {
+public:
+    /// @brief Split the input into parts each of which has one or more YAML documents.
+    /// @note Document end marker lines which separate documents are excluded from the resulting parts.
+    /// @param input The input buffer.
+    /// @return std::vector<str_view> Views into the input buffer for each part. (never empty)
+    static std::vector<str_view> split(str_view input) {
+        std::vector<str_view> docs {};
+        document_boundary_scanner scanner {};
+
+        const char* p_end = input.end();
+        const char* p_doc_begin = input.begin();
+        const char* p_line_begin = p_doc_begin;
+        while (p_line_begin != p_end) {
+            const char* p_line_end = p_line_begin;
+            while (p_line_end != p_end && *p_line_end != '\n') {
+                ++p_line_end;
+            }
+            const char* p_next_line_begin = (p_line_end == p_end) ? p_end : p_line_end + 1;
+
+            switch (scanner.scan_line(str_view(p_line_begin, p_line_end))) {
+            case document_boundary_t::BEFORE:
+                docs.emplace_back(p_doc_begin, p_line_begin);
+                p_doc_begin = p_line_begin;
+                break;
+            case document_boundary_t::END_MARKER:
+                docs.emplace_back(p_doc_begin, p_line_begin);
+                p_doc_begin = p_next_line_begin;
+                break;
+            case document_boundary_t::NONE:
+                break;
+            }
+
+            p_line_begin = p_next_line_begin;
+        }
+
+        docs.emplace_back(p_doc_begin, p_end);
+        return docs;
+    }
+
+    /// @brief Scan a line and find a document boundary if any.
+    /// @param line A line without the trailing newline code.
+    /// @return document_boundary_t The type of the document boundary found in the line.
+    document_boundary_t scan_line(str_view line) noexcept {
+        if (m_in_block_scalar) {
+            bool is_content = scan_block_scalar_line(line);
+            if (is_content) {
+                return document_boundary_t::NONE;
+            }
+            // the block scalar has ended. fall through to scan the line as usual.
+        }
+
+        // document markers in flow collections or quoted scalars are left to the deserializer to be diagnosed.
+        bool in_flow_or_quoted = m_flow_depth > 0 || m_quote != '\0';
+        bool has_marker =
+            !in_flow_or_quoted && line.size() >= 3 && (line.size() == 3 || line[3] == ' ' || line[3] == '\t');
+        if (has_marker && line.starts_with("---")) {
+            bool begins_new_doc = m_has_contents;
+            str_view rest = line.substr(3);
+            m_has_contents = has_contents(rest);
+            if (m_has_contents) {
+                scan_flow_indicators(rest);
+                m_in_block_scalar = is_block_scalar_header_line(rest);
+            }
+            return begins_new_doc ? document_boundary_t::BEFORE : document_boundary_t::NONE;
+        }
+
+        if (has_marker && line.starts_with("...")) {
+            if (!has_contents(line.substr(3))) {
+                m_has_contents = false;
+                return document_boundary_t::END_MARKER;
+            }
+            // leave a document end marker followed by contents to the deserializer.
+            m_has_contents = true;
+            return document_boundary_t::NONE;
+        }
+
+        if (!m_has_contents && !line.empty() && line[0] == '%') {
+            // directives belong to the next document.
+            return document_boundary_t::NONE;
+        }
+
+        if (in_flow_or_quoted || has_contents(line)) {
+            m_has_contents = true;
+            scan_flow_indicators(line);
+            m_in_block_scalar = m_flow_depth == 0 && m_quote == '\0' && is_block_scalar_header_line(line);
+        }
+        return document_boundary_t::NONE;
+    }
+
+private:
+    /// @brief Scan a line which possibly is a part of block scalar contents.
+    /// @param line A line without the trailing newline code.
+    /// @return true if the line belongs to the block scalar, false otherwise.
+    bool scan_block_scalar_line(str_view line) noexcept {
+        if (m_block_scalar_indent == 0 && !m_is_block_scalar_indent_fixed) {
+            // the indentation of the first non-empty line determines the content indentation.
+            std::size_t first_non_space_pos = line.find_first_not_of(" \t");
+            if (first_non_space_pos == str_view::npos) {
+                return true;
+            }
+            m_block_scalar_indent = static_cast<uint32_t>(first_non_space_pos);
+            m_is_block_scalar_indent_fixed = true;
+            return true;
+        }
+
+        std::size_t first_non_space_pos = line.find_first_not_of(' ');
+        if (first_non_space_pos == str_view::npos || first_non_space_pos >= m_block_scalar_indent) {
+            return true;
+        }
+
+        // less indented non-space characters begin the next token.
+        m_in_block_scalar = false;
+        return false;
+    }
+
+    /// @brief Check if the line has any contents other than white spaces and a comment.
+    /// @param line A line without the trailing newline code.
+    /// @return true if the line has contents, false otherwise.
+    static bool has_contents(str_view line) noexcept {
+        std::size_t pos = line.find_first_not_of(" \t");
+        return pos != str_view::npos && line[pos] != '#';
+    }
+
+    /// @brief Track the nesting depth of flow collections and quoted scalars which continue to the next line.
+    /// @note Counting is conservative: a flow collection beginning is recognized only at the beginning of a token, and
+    /// any miscount just suppresses document boundaries in the rest of the current document.
+    /// @param line A line without the trailing newline code.
+    void scan_flow_indicators(str_view line) noexcept {
+        bool is_token_begin = true;
+        for (std::size_t i = 0; i < line.size(); i++) {
+            char c = line[i];
+
+            if (m_quote != '\0') {
+                if (m_quote == '\"' && c == '\\') {
+                    // skip the escaped character.
+                    i++;
+                }
+                else if (c == m_quote) {
+                    if (c == '\'' && i + 1 < line.size() && line[i + 1] == '\'') {
+                        // an escaped single quote.
+                        i++;
+                    }
+                    else {
+                        m_quote = '\0';
+                    }
+                }
+                is_token_begin = false;
+                continue;
+            }
+
+            switch (c) {
+            case ' ':
+            case '\t':
+            case ',':
+            case ':':
+                is_token_begin = true;
+                continue;
+            case '#':
+                if (is_token_begin) {
+                    // the rest is a comment.
+                    return;
+                }
+                break;
+            case '\"':
+            case '\'':
+                if (is_token_begin) {
+                    m_quote = c;
+                }
+                break;
+            case '[':
+            case '{':
+                if (is_token_begin) {
+                    ++m_flow_depth;
+                    continue;
+                }
+                break;
+            case ']':
+            case '}':
+                if (m_flow_depth > 0) {
+                    --m_flow_depth;
+                }
+                break;
+            default:
+                break;
+            }
+            is_token_begin = false;
+        }
+    }
+
+    /// @brief Check if the line ends with a block scalar header, and if so, prepare for scanning its contents.
+    /// @param line A line without the trailing newline code.
+    /// @return true if the line ends with a block scalar header, false otherwise.
+    bool is_block_scalar_header_line(str_view line) noexcept {
+        // drop a trailing comment if any.
+        std::size_t comment_pos = line.find(" #");
+        if (comment_pos != str_view::npos) {
+            line = line.substr(0, comment_pos);
+        }
+
+        str_view header = pop_last_word(line);
+        if (header.empty() || (header[0] != '|' && header[0] != '>') || header.size() > 3) {
+            return false;
+        }
+
+        uint32_t indent = 0;
+        for (std::size_t i = 1; i < header.size(); i++) {
+            char c = header[i];
+            if ('1' <= c && c <= '9') {
+                indent = static_cast<uint32_t>(c - '0');
+            }
+            else if (c != '+' && c != '-') {
+                return false;
+            }
+        }
+
+        // a block scalar header must begin a node, i.e., follow either a key separator, an indicator for block
+        // collection entries, node properties or nothing in the line.
+        str_view prev_word = pop_last_word(line);
+        if (!prev_word.empty()) {
+            bool begins_node = prev_word.ends_with(':') || prev_word == "-" || prev_word == "?" ||
+                               prev_word[0] == '!' || prev_word[0] == '&';
+            if (!begins_node) {
+                return false;
+            }
+        }
+
+        m_block_scalar_indent = indent;
+        m_is_block_scalar_indent_fixed = indent > 0;
+        return true;
+    }
+
+    /// @brief Remove the last white-space-separated word from the line.
+    /// @param line A line to be modified. Its remaining part before the last word is left.
+    /// @return str_view The last word in the line. (empty if the line has no word)
+    static str_view pop_last_word(str_view& line) noexcept {
+        const char* p_begin = line.begin();
+        const char* p_word_end = line.end();
+        while (p_word_end != p_begin && (*(p_word_end - 1) == ' ' || *(p_word_end - 1) == '\t')) {
+            --p_word_end;
+        }
+
+        const char* p_word_begin = p_word_end;
+        while (p_word_begin != p_begin && *(p_word_begin - 1) != ' ' && *(p_word_begin - 1) != '\t') {
+            --p_word_begin;
+        }
+
+        line = str_view(p_begin, p_word_begin);
+        return str_view(p_word_begin, p_word_end);
+    }
+
+private:
+    /// Whether the current document has any contents.
+    bool m_has_contents {false};
+    /// Whether the scanner is in block scalar contents.
+    bool m_in_block_scalar {false};
+    /// Whether the content indentation of the current block scalar has been determined.
+    bool m_is_block_scalar_indent_fixed {false};
+    /// The content indentation of the current block scalar.
+    uint32_t m_block_scalar_indent {0};
+    /// The nesting depth of the current flow collections.
+    uint32_t m_flow_depth {0};
+    /// The quotation mark of the current quoted scalar. ('\0' if not in a quoted scalar)
+    char m_quote {'\0'};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_DOCUMENT_BOUNDARY_SCANNER_HPP */
@@ -0,0 +1,359 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_DOCUMENT_STREAM_HPP
+#define FK_YAML_DETAIL_INPUT_DOCUMENT_STREAM_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/encodings/utf_encode_t.hpp>
+#include <fkYAML/detail/input/deserializer.hpp>
+#include <fkYAML/detail/input/document_boundary_scanner.hpp>
+#include <fkYAML/detail/input/input_adapter.hpp>
+#include <fkYAML/detail/input/key_intern_table.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/str_view.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A type trait to check if the input adapter type can read its input line by line.
+/// @tparam InputAdapterType An input adapter type.
+template <typename InputAdapterType>
+struct is_line_readable_input_adapter
+    : disjunction<
+          std::is_same<InputAdapterType, file_input_adapter>, std::is_same<InputAdapterType, stream_input_adapter>> {};
+
+/// @brief A range of YAML documents in the input, each of which is deserialized on demand.
+/// @note Only one document at a time is held by this object. Inputs from FILE handles and input streams in the UTF-8
+/// encoding are read just as far as the current document, while the others are read at once but their deserialization
+/// still proceeds document by document.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @tparam InputAdapterType An input adapter type.
+template <typename BasicNodeType, typename InputAdapterType>
+class basic_document_stream {
+    static_assert(is_basic_node<BasicNodeType>::value, "basic_document_stream only accepts basic_node<...>");
+
+    /** A type for the deserializer. */
+    using deserializer_type = basic_deserializer<BasicNodeType>;
+
+public:
+    /// @brief An input iterator which deserializes the next document on each increment.
+    class iterator {
+    public:
+        /** A type for iterator categories. */
+        using iterator_category = std::input_iterator_tag;
+        /** A type for values. */
+        using value_type = BasicNodeType;
+        /** A type for differences between iterators. */
+        using difference_type = std::ptrdiff_t;
+        /** A type for pointers to values. */
+        using pointer = value_type*;
+        /** A type for references to values. */
+        using reference = value_type&;
+
+        /// @brief Construct a new iterator object which represents the end of documents.
+        iterator() = default;
+
+        /// @brief Construct a new iterator object which refers to the current document of the stream.
+        /// @param p_stream A pointer to the stream.
+        explicit iterator(basic_document_stream* p_stream) noexcept
+            : mp_stream(p_stream) {
+        }
+
+        /// @brief Get the reference to the current document.
+        /// @return reference The reference to the current document.
+        reference operator*() const noexcept {
+            return mp_stream->m_current;
+        }
+
+        /// @brief Get the pointer to the current document.
+        /// @return pointer The pointer to the current document.
+        pointer operator->() const noexcept {
+            return &mp_stream->m_current;
+        }
+
+        /// @brief Deserialize the next document. The previous one is destroyed.
+        /// @return iterator& The reference to this iterator.
+        iterator& operator++() {
+            if (!mp_stream->next()) {
+                mp_stream = nullptr;
+            }
+            return *this;
+        }
+
+        /// @brief Check if the given iterator is equal to this iterator.
+        /// @param rhs An iterator to compare with.
+        /// @return true if both iterators are at the end of documents or refer to the same stream, false otherwise.
+        bool operator==(const iterator& rhs) const noexcept {
+            return mp_stream == rhs.mp_stream;
+        }
+
+        /// @brief Check if the given iterator is not equal to this iterator.
+        /// @param rhs An iterator to compare with.
+        /// @return true if both iterators are not equal, false otherwise.
+        bool operator!=(const iterator& rhs) const noexcept {
+            return mp_stream != rhs.mp_stream;
+        }
+
+    private:
+        /// The pointer to the stream. (nullptr at the end of documents)
+        basic_document_stream* mp_stream {nullptr};
+    };
+
+    /// @brief Construct a new basic_document_stream object.
+    /// @note The input source referred to by the input adapter must outlive this object.
+    /// @param input_adapter An input adapter object.
+    /// @param p_key_table A table to intern mapping key strings into. If null, mapping keys are not interned.
+    explicit basic_document_stream(
+        InputAdapterType&& input_adapter, std::shared_ptr<key_intern_table> p_key_table = nullptr)
+        : m_input_adapter(std::move(input_adapter)) {
+        m_deserializer.set_key_intern_table(std::move(p_key_table));
+    }
+
+    // disable copy construction/assignment since iterators refer to this object.
+    basic_document_stream(const basic_document_stream&) = delete;
+    basic_document_stream& operator=(const basic_document_stream&) = delete;
+
+    basic_document_stream(basic_document_stream&&) = default;
+    basic_document_stream& operator=(basic_document_stream&&) = default;
+
+    ~basic_document_stream() = default;
+
+    /// @brief Get an iterator to the first document. The first document is deserialized on the first call.
+    /// @note Since the stream can be iterated only once, the subsequent calls return an iterator to the current one.
+    /// @return iterator An iterator to the first document.
+    iterator begin() {
+        if (!m_is_started) {
+            m_is_started = true;
+            m_has_current = next();
+        }
+        return m_has_current ? iterator(this) : iterator();
+    }
+
+    /// @brief Get an iterator which represents the end of documents.
+    /// @return iterator An iterator which represents the end of documents.
+    iterator end() noexcept {
+        return iterator();
+    }
+
+private:
+    /// @brief Deserialize the next document into the current one.
+    /// @return true if a document has been deserialized, false if no more document is available.
+    bool next() {
+        while (m_doc_idx == m_docs.size()) {
+            str_view part {};
+            uint32_t first_line = 0;
+            if (!read_next_part(part, first_line)) {
+                m_has_current = false;
+                m_current = BasicNodeType();
+                return false;
+            }
+
+            // A part contains more than one document if some document markers have not been detected as boundaries.
+            m_docs = m_deserializer.deserialize_docs_impl(part, first_line);
+            m_doc_idx = 0;
+        }
+
+        m_current = std::move(m_docs[m_doc_idx++]);
+        m_has_current = true;
+        return true;
+    }
+
+    /// @brief Read the next part of the input which has at least one document.
+    /// @param part The storage for the next part.
+    /// @param first_line The storage for the line number of the beginning of the next part.
+    /// @return true if the next part is available, false otherwise.
+    bool read_next_part(str_view& part, uint32_t& first_line) {
+        if (m_is_end_of_input) {
+            return false;
+        }
+
+        if (!m_is_initialized) {
+            m_is_initialized = true;
+            m_is_incremental = is_incremental(m_input_adapter);
+            if (!m_is_incremental) {
+                m_buffer = m_input_adapter.get_buffer_view();
+                mp_cur = mp_part_begin = m_buffer.begin();
+            }
+        }
+
+        first_line = m_lines_read;
+        return m_is_incremental ? read_next_part_incrementally(part) : read_next_part_from_buffer(part);
+    }
+
+    /// @brief Read the next part from the whole input buffer.
+    /// @param part The storage for the next part.
+    /// @return true since the last part may be empty.
+    bool read_next_part_from_buffer(str_view& part) {
+        const char* p_end = m_buffer.end();
+        while (mp_cur != p_end) {
+            const char* p_line_begin = mp_cur;
+            const char* p_line_end = p_line_begin;
+            while (p_line_end != p_end && *p_line_end != '\n') {
+                ++p_line_end;
+            }
+            mp_cur = (p_line_end == p_end) ? p_end : p_line_end + 1;
+
+            switch (m_scanner.scan_line(str_view(p_line_begin, p_line_end))) {
+            case document_boundary_t::BEFORE:
+                part = str_view(mp_part_begin, p_line_begin);
+                mp_part_begin = p_line_begin;
+                // the current line belongs to the next part.
+                m_lines_read += count_lines(part);
+                return true;
+            case document_boundary_t::END_MARKER:
+                part = str_view(mp_part_begin, p_line_begin);
+                mp_part_begin = mp_cur;
+                m_lines_read += count_lines(part) + 1;
+                return true;
+            case document_boundary_t::NONE:
+                break;
+            }
+        }
+
+        part = str_view(mp_part_begin, p_end);
+        m_is_end_of_input = true;
+        return true;
+    }
+
+    /// @brief Read the next part from the input line by line.
+    /// @param part The storage for the next part.
+    /// @return true since the last part may be empty.
+    bool read_next_part_incrementally(str_view& part) {
+        // the line which has begun the next part in the previous call.
+        m_part.swap(m_next_part_head);
+        m_next_part_head.clear();
+
+        for (;;) {
+            m_line.clear();
+            if (!read_line(m_input_adapter, m_line)) {
+                break;
+            }
+
+            str_view line = m_line;
+            if (line.ends_with('\n')) {
+                line.remove_suffix(1);
+            }
+
+            switch (m_scanner.scan_line(line)) {
+            case document_boundary_t::BEFORE:
+                m_next_part_head.swap(m_line);
+                part = m_part;
+                m_lines_read += count_lines(part);
+                return true;
+            case document_boundary_t::END_MARKER:
+                part = m_part;
+                m_lines_read += count_lines(part) + 1;
+                return true;
+            case document_boundary_t::NONE:
+                m_part += m_line;
+                break;
+            }
+        }
+
+        part = m_part;
+        m_is_end_of_input = true;
+        return true;
+    }
+
+    /// @brief Count the number of lines which end in the given part.
+    /// @param part A part of the input.
+    /// @return uint32_t The number of newline codes in the part.
+    static uint32_t count_lines(str_view part) noexcept {
+        uint32_t count = 0;
+        for (char c : part) {
+            if (c == '\n') {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    /// @brief Check if the input can be read line by line.
+    /// @param input_adapter An input adapter which supports line-by-line reading.
+    /// @return true if the input is encoded in UTF-8, false otherwise.
+    template <
+        typename AdapterType, enable_if_t<is_line_readable_input_adapter<AdapterType>::value, int> = 0>
+    static bool is_incremental(const AdapterType& input_adapter) noexcept {
+        return input_adapter.get_encode_type() == utf_encode_t::UTF_8;
+    }
+
+    /// @brief Check if the input can be read line by line.
+    /// @return false since the input adapter doesn't support line-by-line reading.
+    template <
+        typename AdapterType, enable_if_t<!is_line_readable_input_adapter<AdapterType>::value, int> = 0>
+    static bool is_incremental(const AdapterType& /*unused*/) noexcept {
+        return false;
+    }
+
+    /// @brief Read the next line from the input.
+    /// @param input_adapter An input adapter which supports line-by-line reading.
+    /// @param line The storage for the line.
+    /// @return true if any characters have been read, false otherwise.
+    template <
+        typename AdapterType, enable_if_t<is_line_readable_input_adapter<AdapterType>::value, int> = 0>
+    static bool read_line(AdapterType& input_adapter, std::string& line) {
+        return input_adapter.read_line(line);
+    }
+
+    /// @brief Read the next line from the input.
+    /// @return false since the input adapter doesn't support line-by-line reading.
+    template <
+        typename AdapterType, enable_if_t<!is_line_readable_input_adapter<AdapterType>::value, int> = 0>
+    static bool read_line(AdapterType& /*unused*/, std::string& /*unused*/) {
+        return false; // LCOV_EXCL_LINE
+    }
+
+private:
+    /// The input adapter.
+    InputAdapterType m_input_adapter;
+    /// The deserializer for each part of the input.
+    deserializer_type m_deserializer {};
+    /// The scanner of document boundaries.
+    document_boundary_scanner m_scanner {};
+    /// The documents deserialized from the current part.
+    std::vector<BasicNodeType> m_docs {};
+    /// The index of the next document in m_docs.
+    std::size_t m_doc_idx {0};
+    /// The current document.
+    BasicNodeType m_current {};
+    /// The number of lines which precede the next part.
+    uint32_t m_lines_read {0};
+    /// The whole input buffer. (used only if the input is not read incrementally)
+    str_view m_buffer {};
+    /// The beginning of the next line in m_buffer.
+    const char* mp_cur {nullptr};
+    /// The beginning of the next part in m_buffer.
+    const char* mp_part_begin {nullptr};
+    /// The buffer for the current part. (used only if the input is read incrementally)
+    std::string m_part {};
+    /// The buffer for the line which begins the next part.
+    std::string m_next_part_head {};
+    /// The buffer for the last read line.
+    std::string m_line {};
+    /// Whether begin() has been called.
+    bool m_is_started {false};
+    /// Whether the current document is available.
+    bool m_has_current {false};
+    /// Whether the input adapter has been examined.
+    bool m_is_initialized {false};
+    /// Whether the input is read incrementally.
+    bool m_is_incremental {false};
+    /// Whether the whole input has been consumed.
+    bool m_is_end_of_input {false};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_DOCUMENT_STREAM_HPP */
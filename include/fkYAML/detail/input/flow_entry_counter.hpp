@@ -0,0 +1,152 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_FLOW_ENTRY_COUNTER_HPP
+#define FK_YAML_DETAIL_INPUT_FLOW_ENTRY_COUNTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/str_view.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A class which pre-counts entries of flow collections so that their containers can be reserved up front.
+/// @note The counts are only hints. Since the input is scanned in a single pass without validation, they may be off
+/// for malformed inputs, which are rejected later by the deserializer anyway.
+class flow_entry_counter {
+public:
+    /// @brief Count entries of an outermost flow collection and all the flow collections nested in it.
+    /// @note The counts are stored in order of the beginnings of the flow collections and replace the previous ones.
+    /// @param input The input right after the beginning of the outermost flow collection (`[` or `{`).
+    void count(str_view input) {
+        m_counts.clear();
+        m_next_index = 0;
+        m_open_indices.clear();
+
+        m_open_indices.push_back(0);
+        m_counts.push_back(0);
+        bool has_entry = false;
+        bool is_in_plain = false;
+
+        const char* p_cur = input.begin();
+        const char* p_end = input.end();
+        while (p_cur != p_end) {
+            switch (*p_cur) {
+            case ' ':
+            case '\t':
+            case '\r':
+            case '\n':
+                is_in_plain = false;
+                break;
+            case '#':
+                if (is_in_plain) {
+                    break;
+                }
+                // skip a comment.
+                while (p_cur != p_end && *p_cur != '\n') {
+                    ++p_cur;
+                }
+                continue;
+            case '\"':
+            case '\'':
+                has_entry = true;
+                if (is_in_plain) {
+                    break;
+                }
+                p_cur = skip_quoted_scalar(p_cur, p_end);
+                continue;
+            case ':':
+                // a key separator may be directly followed by a quoted scalar like JSON.
+                has_entry = true;
+                is_in_plain = false;
+                break;
+            case ',':
+                if (has_entry) {
+                    ++m_counts[m_open_indices.back()];
+                    has_entry = false;
+                }
+                is_in_plain = false;
+                break;
+            case '[':
+            case '{':
+                m_open_indices.push_back(static_cast<uint32_t>(m_counts.size()));
+                m_counts.push_back(0);
+                has_entry = false;
+                is_in_plain = false;
+                break;
+            case ']':
+            case '}':
+                if (has_entry) {
+                    ++m_counts[m_open_indices.back()];
+                }
+                m_open_indices.pop_back();
+                if (m_open_indices.empty()) {
+                    // the end of the outermost flow collection.
+                    return;
+                }
+                // the closed flow collection is an entry of the enclosing one.
+                has_entry = true;
+                is_in_plain = false;
+                break;
+            default:
+                has_entry = true;
+                is_in_plain = true;
+                break;
+            }
+            ++p_cur;
+        }
+    }
+
+    /// @brief Get the entry count of the next flow collection in order of their beginnings.
+    /// @return uint32_t The entry count, or 0 if no more counts are available.
+    uint32_t next() noexcept {
+        if FK_YAML_LIKELY (m_next_index < m_counts.size()) {
+            return m_counts[m_next_index++];
+        }
+        return 0;
+    }
+
+private:
+    /// @brief Skip a single or double quoted scalar.
+    /// @param p_cur The pointer to the beginning quotation mark.
+    /// @param p_end The end of the input.
+    /// @return const char* The pointer to the next character of the ending quotation mark, or the end of the input.
+    static const char* skip_quoted_scalar(const char* p_cur, const char* p_end) noexcept {
+        const char quote = *p_cur++;
+        while (p_cur != p_end) {
+            if (*p_cur == quote) {
+                ++p_cur;
+                // an escaped single quotation mark ('') in a single quoted scalar.
+                bool is_escaped = quote == '\'' && p_cur != p_end && *p_cur == '\'';
+                if (!is_escaped) {
+                    return p_cur;
+                }
+            }
+            else if (quote == '\"' && *p_cur == '\\' && p_end - p_cur > 1) {
+                ++p_cur;
+            }
+            ++p_cur;
+        }
+        return p_end;
+    }
+
+private:
+    /// The entry counts of flow collections in order of their beginnings.
+    std::vector<uint32_t> m_counts {};
+    /// The index of the entry count to be returned next.
+    std::size_t m_next_index {0};
+    /// The indices of the entry counts of the flow collections which are currently open.
+    std::vector<uint32_t> m_open_indices {};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_FLOW_ENTRY_COUNTER_HPP */
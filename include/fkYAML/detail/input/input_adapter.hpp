@@ -21,6 +21,7 @@
 #include <fkYAML/detail/encodings/utf_encode_detector.hpp>
 #include <fkYAML/detail/encodings/utf_encode_t.hpp>
 #include <fkYAML/detail/encodings/utf_encodings.hpp>
+#include <fkYAML/detail/instrumentation.hpp>
 #include <fkYAML/detail/meta/input_adapter_traits.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
 #include <fkYAML/detail/str_view.hpp>
@@ -28,6 +29,74 @@
 
 FK_YAML_DETAIL_NAMESPACE_BEGIN
 
+namespace {
+
+/// @brief Validate the UTF-8 encoding of the given characters.
+/// @param p_current The beginning of the characters.
+/// @param p_end The end of the characters.
+inline void validate_utf8_chars(const char* p_current, const char* p_end) {
+    while (p_current != p_end) {
+        uint8_t first = uint8_t(*p_current++);
+        uint32_t num_bytes = utf8::get_num_bytes(first);
+        if FK_YAML_LIKELY (num_bytes == 1) {
+            continue;
+        }
+
+        if FK_YAML_UNLIKELY (static_cast<uint32_t>(p_end - p_current) < num_bytes - 1) {
+            throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", {first});
+        }
+
+        bool is_valid = false;
+        switch (num_bytes) {
+        case 2: {
+            std::initializer_list<uint8_t> bytes {first, uint8_t(p_current[0])};
+            is_valid = utf8::validate(bytes);
+            if FK_YAML_UNLIKELY (!is_valid) {
+                throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", bytes);
+            }
+            break;
+        }
+        case 3: {
+            std::initializer_list<uint8_t> bytes {first, uint8_t(p_current[0]), uint8_t(p_current[1])};
+            is_valid = utf8::validate(bytes);
+            if FK_YAML_UNLIKELY (!is_valid) {
+                throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", bytes);
+            }
+            break;
+        }
+        default: { // 4
+            std::initializer_list<uint8_t> bytes {
+                first, uint8_t(p_current[0]), uint8_t(p_current[1]), uint8_t(p_current[2])};
+            is_valid = utf8::validate(bytes);
+            if FK_YAML_UNLIKELY (!is_valid) {
+                throw fkyaml::invalid_encoding("Invalid UTF-8 encoding.", bytes);
+            }
+            break;
+        }
+        }
+
+        p_current += num_bytes - 1;
+    }
+}
+
+/// @brief Append the given characters to the string, dropping CRs for newline code normalization.
+/// @param str The destination string.
+/// @param p_current The beginning of the characters.
+/// @param p_end The end of the characters.
+inline void append_without_cr(std::string& str, const char* p_current, const char* p_end) {
+    while (p_current != p_end) {
+        const char* p_cr_or_end = p_current;
+        while (p_cr_or_end != p_end && *p_cr_or_end != '\r') {
+            ++p_cr_or_end;
+        }
+
+        str.append(p_current, p_cr_or_end);
+        p_current = (p_cr_or_end == p_end) ? p_end : p_cr_or_end + 1;
+    }
+}
+
+} // anonymous namespace
+
 ///////////////////////
 //   input_adapter   //
 ///////////////////////
@@ -65,6 +134,8 @@ public:
     /// @brief Get view into the input buffer contents.
     /// @return View into the input buffer contents.
     str_view get_buffer_view() {
+        FK_YAML_INSTRUMENT_PHASE(INPUT_NORMALIZATION);
+
         m_buffer.clear();
 
         switch (m_encode_type) {
@@ -81,6 +152,13 @@ public:
         }
     }
 
+    /// @brief Check if the view returned by get_buffer_view() refers to the input itself.
+    /// @note Unlike a normalized copy of the input, such a view remains valid as long as the input does.
+    /// @return true if the view refers to the input itself, false otherwise.
+    bool refers_to_input() const noexcept {
+        return m_is_contiguous && m_buffer.empty();
+    }
+
 private:
     /// @brief The concrete implementation of get_buffer_view() for UTF-8 encoded inputs.
     /// @return View into the UTF-8 encoded input buffer contents.
@@ -142,6 +220,7 @@ private:
             cr_or_end_itr = std::find(current, m_end, '\r');
         } while (current != m_end);
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
@@ -191,6 +270,7 @@ private:
             m_buffer.append(reinterpret_cast<const char*>(utf8_buffer.data()), utf8_buf_size);
         }
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
@@ -232,6 +312,7 @@ private:
             }
         }
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
@@ -283,6 +364,8 @@ public:
     /// @brief Get view into the input buffer contents.
     /// @return View into the input buffer contents.
     str_view get_buffer_view() {
+        FK_YAML_INSTRUMENT_PHASE(INPUT_NORMALIZATION);
+
         IterType current = m_begin;
         while (current != m_end) {
             uint8_t first = static_cast<uint8_t>(*current++);
@@ -330,9 +413,16 @@ public:
             }
         }
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
+    /// @brief Check if the view returned by get_buffer_view() refers to the input itself.
+    /// @return false since the input is always copied into the owned buffer.
+    bool refers_to_input() const noexcept {
+        return false;
+    }
+
 private:
     /// The iterator at the beginning of input.
     IterType m_begin {};
@@ -379,6 +469,8 @@ public:
     /// @brief Get view into the input buffer contents.
     /// @return View into the input buffer contents.
     str_view get_buffer_view() {
+        FK_YAML_INSTRUMENT_PHASE(INPUT_NORMALIZATION);
+
         int shift_bits = (m_encode_type == utf_encode_t::UTF_16BE) ? 0 : 8;
 
         std::array<char16_t, 2> encoded_buffer {{0, 0}};
@@ -415,9 +507,16 @@ public:
             m_buffer.append(reinterpret_cast<const char*>(utf8_buffer.data()), utf8_buf_size);
         }
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
+    /// @brief Check if the view returned by get_buffer_view() refers to the input itself.
+    /// @return false since the input is always copied into the owned buffer.
+    bool refers_to_input() const noexcept {
+        return false;
+    }
+
 private:
     /// The iterator at the beginning of input.
     IterType m_begin {};
@@ -462,6 +561,8 @@ public:
     /// @brief Get view into the input buffer contents.
     /// @return View into the input buffer contents.
     str_view get_buffer_view() {
+        FK_YAML_INSTRUMENT_PHASE(INPUT_NORMALIZATION);
+
         int shift_bits[4] {0, 0, 0, 0};
         if (m_encode_type == utf_encode_t::UTF_32LE) {
             shift_bits[0] = 24;
@@ -492,9 +593,16 @@ public:
             }
         }
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
+    /// @brief Check if the view returned by get_buffer_view() refers to the input itself.
+    /// @return false since the input is always copied into the owned buffer.
+    bool refers_to_input() const noexcept {
+        return false;
+    }
+
 private:
     /// The iterator at the beginning of input.
     IterType m_begin {};
@@ -520,9 +628,11 @@ public:
     /// It's user's responsibility to call those functions.
     /// @param file A file handle for this adapter. (A non-null pointer is assumed.)
     /// @param encode_type The encoding type for this input adapter.
-    explicit file_input_adapter(std::FILE* file, utf_encode_t encode_type) noexcept
+    /// @param leading_bytes The bytes which have already been read from the file, excluding a BOM.
+    explicit file_input_adapter(std::FILE* file, utf_encode_t encode_type, std::string leading_bytes = {}) noexcept
         : m_file(file),
-          m_encode_type(encode_type) {
+          m_encode_type(encode_type),
+          m_window(std::move(leading_bytes)) {
     }
 
     // allow only move construct/assignment
@@ -535,6 +645,8 @@ public:
     /// @brief Get view into the input buffer contents.
     /// @return View into the input buffer contents.
     str_view get_buffer_view() {
+        FK_YAML_INSTRUMENT_PHASE(INPUT_NORMALIZATION);
+
         switch (m_encode_type) {
         case utf_encode_t::UTF_8:
             return get_buffer_view_utf8();
@@ -549,31 +661,57 @@ public:
         }
     }
 
+    /// @brief Get the encoding type of the input.
+    /// @return utf_encode_t The encoding type of the input.
+    utf_encode_t get_encode_type() const noexcept {
+        return m_encode_type;
+    }
+
+    /// @brief Read the next line from the UTF-8 encoded input without reading the rest of the input.
+    /// @note CRs are removed just as get_buffer_view() does.
+    /// @param line The storage to which the line is appended, including the newline code at its end if any.
+    /// @return true if any characters have been read, false if the input has been consumed.
+    bool read_line(std::string& line) {
+        FK_YAML_ASSERT(m_encode_type == utf_encode_t::UTF_8);
+
+        std::size_t old_size = line.size();
+        bool has_read = false;
+        while (fill_window_line()) {
+            has_read = true;
+
+            const char* p_current = m_window.data() + m_window_pos;
+            const char* p_end = m_window.data() + m_window.size();
+            const char* p_newline =
+                static_cast<const char*>(std::memchr(p_current, '\n', static_cast<std::size_t>(p_end - p_current)));
+            const char* p_line_end = p_newline ? p_newline + 1 : p_end;
+
+            // a line longer than a window refill is carried over to the next one.
+            append_without_cr(line, p_current, p_line_end);
+            m_window_pos = static_cast<std::size_t>(p_line_end - m_window.data());
+            if (p_newline) {
+                break;
+            }
+        }
+
+        validate_utf8_chars(line.data() + old_size, line.data() + line.size());
+        return has_read;
+    }
+
+    /// @brief Check if the view returned by get_buffer_view() refers to the input itself.
+    /// @return false since the input is always copied into the owned buffer.
+    bool refers_to_input() const noexcept {
+        return false;
+    }
+
 private:
     /// @brief The concrete implementation of get_buffer_view() for UTF-8 encoded inputs.
     /// @return View into the UTF-8 encoded input buffer contents.
     str_view get_buffer_view_utf8() {
         FK_YAML_ASSERT(m_encode_type == utf_encode_t::UTF_8);
 
-        char tmp_buf[256] {};
-        std::size_t buf_size = sizeof(tmp_buf) / sizeof(tmp_buf[0]);
-        std::size_t read_size = 0;
-        while ((read_size = std::fread(&tmp_buf[0], sizeof(char), buf_size, m_file)) > 0) {
-            char* p_current = &tmp_buf[0];
-            char* p_end = p_current + read_size;
-            do {
-                // find CR in `tmp_buf`.
-                char* p_cr_or_end = p_current;
-                while (p_cr_or_end != p_end) {
-                    if (*p_cr_or_end == '\r') {
-                        break;
-                    }
-                    ++p_cr_or_end;
-                }
-
-                m_buffer.append(p_current, p_cr_or_end);
-                p_current = (p_cr_or_end == p_end) ? p_end : p_cr_or_end + 1;
-            } while (p_current != p_end);
+        while (fill_window()) {
+            append_without_cr(m_buffer, m_window.data() + m_window_pos, m_window.data() + m_window.size());
+            m_window_pos = m_window.size();
         }
 
         auto current = m_buffer.begin();
@@ -614,6 +752,7 @@ private:
             }
         }
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
@@ -636,8 +775,8 @@ private:
         std::array<uint8_t, 4> utf8_buffer {{0, 0, 0, 0}};
         uint32_t utf8_buf_size {0};
 
-        while (std::feof(m_file) == 0) {
-            while (encoded_buf_size < 2 && std::fread(&chars[0], sizeof(char), 2, m_file) == 2) {
+        while (!m_is_end_of_input) {
+            while (encoded_buf_size < 2 && read_bytes(&chars[0], 2) == 2) {
                 char16_t utf16 = char16_t(
                     static_cast<uint16_t>(uint8_t(chars[0]) << shift_bits[0]) |
                     static_cast<uint16_t>(uint8_t(chars[1]) << shift_bits[1]));
@@ -657,6 +796,7 @@ private:
             m_buffer.append(reinterpret_cast<const char*>(utf8_buffer.data()), utf8_buf_size);
         }
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
@@ -681,8 +821,8 @@ private:
         std::array<uint8_t, 4> utf8_buffer {{0, 0, 0, 0}};
         uint32_t utf8_buf_size {0};
 
-        while (std::feof(m_file) == 0) {
-            std::size_t size = std::fread(&chars[0], sizeof(char), 4, m_file);
+        for (;;) {
+            std::size_t size = read_bytes(&chars[0], 4);
             if (size != 4) {
                 break;
             }
@@ -699,16 +839,98 @@ private:
             }
         }
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
+    /// @brief Read the next chunk from the input file into the window buffer if all of it has been consumed.
+    /// @return true if the window buffer has unconsumed characters, false if the whole input has been consumed.
+    bool fill_window() {
+        if (m_window_pos < m_window.size()) {
+            return true;
+        }
+        if (m_is_end_of_input) {
+            return false;
+        }
+
+        m_window.resize(chunk_size);
+        std::size_t read_size = std::fread(&m_window[0], sizeof(char), chunk_size, m_file);
+        m_window.resize(read_size);
+        m_window_pos = 0;
+
+        m_is_end_of_input = (read_size == 0);
+        return !m_is_end_of_input;
+    }
+
+    /// @brief Read the next line (at most chunk_size - 1 characters of it) from the input file into the window buffer
+    /// if all of it has been consumed.
+    /// @note Unlike fill_window(), this doesn't wait for a whole chunk so that lines written to pipes are available
+    /// as soon as they arrive.
+    /// @return true if the window buffer has unconsumed characters, false if the whole input has been consumed.
+    bool fill_window_line() {
+        if (m_window_pos < m_window.size()) {
+            return true;
+        }
+        if (m_is_end_of_input) {
+            return false;
+        }
+
+        // The window is filled with newlines beforehand so that the end of the read characters can be found even if
+        // they contain null characters: a read newline is followed by the null terminator, and a filled one is not.
+        // Note that a newline at the last position is always a filled one since std::fgets() reads at most
+        // chunk_size - 1 characters, which means chunk_size - 2 characters have been read without a newline.
+        m_window.assign(chunk_size, '\n');
+        m_window_pos = 0;
+        if (std::fgets(&m_window[0], static_cast<int>(chunk_size), m_file) == nullptr) {
+            m_window.clear();
+            m_is_end_of_input = true;
+            return false;
+        }
+
+        std::size_t read_size = chunk_size - 1;
+        const char* p_begin = m_window.data();
+        const char* p_newline = static_cast<const char*>(std::memchr(p_begin, '\n', chunk_size));
+        if (p_newline) {
+            std::size_t newline_pos = static_cast<std::size_t>(p_newline - p_begin);
+            bool is_read_newline = newline_pos + 1 < chunk_size && m_window[newline_pos + 1] == '\0';
+            read_size = is_read_newline ? newline_pos + 1 : newline_pos - 1;
+        }
+        m_window.resize(read_size);
+        return true;
+    }
+
+    /// @brief Read raw bytes from the input file through the window buffer.
+    /// @param p_dst The destination buffer.
+    /// @param size The number of bytes to be read.
+    /// @return std::size_t The number of bytes which have actually been read.
+    std::size_t read_bytes(char* p_dst, std::size_t size) {
+        std::size_t total = 0;
+        while (total < size && fill_window()) {
+            std::size_t available = m_window.size() - m_window_pos;
+            std::size_t n = (size - total < available) ? size - total : available;
+            std::memcpy(p_dst + total, m_window.data() + m_window_pos, n);
+            m_window_pos += n;
+            total += n;
+        }
+        return total;
+    }
+
 private:
+    /// The size of a chunk read from the input file at once.
+    static constexpr std::size_t chunk_size = 4096;
+
     /// A pointer to the input file handle.
     std::FILE* m_file {nullptr};
     /// The encoding type for this input adapter.
     utf_encode_t m_encode_type {utf_encode_t::UTF_8};
     /// The normalized owned buffer.
     std::string m_buffer {};
+    /// The window buffer which holds the last chunk read from the input.
+    std::string m_window {};
+    /// The position of the first unconsumed character in the window buffer.
+    std::size_t m_window_pos {0};
+    /// Whether the whole input has been read.
+    bool m_is_end_of_input {false};
 };
 
 /// @brief An input adapter for streams
@@ -720,9 +942,11 @@ public:
     /// @brief Construct a new stream_input_adapter object.
     /// @param is A reference to the target input stream.
     /// @param encode_type The encoding type for this input adapter.
-    explicit stream_input_adapter(std::istream& is, utf_encode_t encode_type) noexcept
+    /// @param leading_bytes The bytes which have already been read from the stream, excluding a BOM.
+    explicit stream_input_adapter(std::istream& is, utf_encode_t encode_type, std::string leading_bytes = {}) noexcept
         : m_istream(&is),
-          m_encode_type(encode_type) {
+          m_encode_type(encode_type),
+          m_window(std::move(leading_bytes)) {
     }
 
     // allow only move construct/assignment
@@ -735,6 +959,8 @@ public:
     /// @brief Get view into the input buffer contents.
     /// @return View into the input buffer contents.
     str_view get_buffer_view() {
+        FK_YAML_INSTRUMENT_PHASE(INPUT_NORMALIZATION);
+
         switch (m_encode_type) {
         case utf_encode_t::UTF_8:
             return get_buffer_view_utf8();
@@ -749,33 +975,58 @@ public:
         }
     }
 
+    /// @brief Get the encoding type of the input.
+    /// @return utf_encode_t The encoding type of the input.
+    utf_encode_t get_encode_type() const noexcept {
+        return m_encode_type;
+    }
+
+    /// @brief Read the next line from the UTF-8 encoded input without reading the rest of the input.
+    /// @note CRs are removed just as get_buffer_view() does.
+    /// @param line The storage to which the line is appended, including the newline code at its end if any.
+    /// @return true if any characters have been read, false if the input has been consumed.
+    bool read_line(std::string& line) {
+        FK_YAML_ASSERT(m_encode_type == utf_encode_t::UTF_8);
+
+        std::size_t old_size = line.size();
+        bool has_read = false;
+        while (fill_window_line()) {
+            has_read = true;
+
+            const char* p_current = m_window.data() + m_window_pos;
+            const char* p_end = m_window.data() + m_window.size();
+            const char* p_newline =
+                static_cast<const char*>(std::memchr(p_current, '\n', static_cast<std::size_t>(p_end - p_current)));
+            const char* p_line_end = p_newline ? p_newline + 1 : p_end;
+
+            // a line longer than a window refill is carried over to the next one.
+            append_without_cr(line, p_current, p_line_end);
+            m_window_pos = static_cast<std::size_t>(p_line_end - m_window.data());
+            if (p_newline) {
+                break;
+            }
+        }
+
+        validate_utf8_chars(line.data() + old_size, line.data() + line.size());
+        return has_read;
+    }
+
+    /// @brief Check if the view returned by get_buffer_view() refers to the input itself.
+    /// @return false since the input is always copied into the owned buffer.
+    bool refers_to_input() const noexcept {
+        return false;
+    }
+
 private:
     /// @brief The concrete implementation of get_buffer_view() for UTF-8 encoded inputs.
     /// @return View into the UTF-8 encoded input buffer contents.
     str_view get_buffer_view_utf8() {
         FK_YAML_ASSERT(m_encode_type == utf_encode_t::UTF_8);
 
-        char tmp_buf[256] {};
-        do {
-            m_istream->read(&tmp_buf[0], 256);
-            std::size_t read_size = static_cast<std::size_t>(m_istream->gcount());
-
-            char* p_current = &tmp_buf[0];
-            char* p_end = p_current + read_size;
-            do {
-                // find CR in `tmp_buf`.
-                char* p_cr_or_end = p_current;
-                while (p_cr_or_end != p_end) {
-                    if (*p_cr_or_end == '\r') {
-                        break;
-                    }
-                    ++p_cr_or_end;
-                }
-
-                m_buffer.append(p_current, p_cr_or_end);
-                p_current = (p_cr_or_end == p_end) ? p_end : p_cr_or_end + 1;
-            } while (p_current != p_end);
-        } while (!m_istream->eof());
+        while (fill_window()) {
+            append_without_cr(m_buffer, m_window.data() + m_window_pos, m_window.data() + m_window.size());
+            m_window_pos = m_window.size();
+        }
 
         auto current = m_buffer.begin();
         auto end = m_buffer.end();
@@ -815,6 +1066,7 @@ private:
             }
         }
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
@@ -837,10 +1089,9 @@ private:
         std::array<uint8_t, 4> utf8_buffer {{0, 0, 0, 0}};
         uint32_t utf8_buf_size {0};
 
-        do {
+        while (!m_is_end_of_input) {
             while (encoded_buf_size < 2) {
-                m_istream->read(&chars[0], 2);
-                std::streamsize size = m_istream->gcount();
+                std::size_t size = read_bytes(&chars[0], 2);
                 if (size != 2) {
                     break;
                 }
@@ -863,8 +1114,9 @@ private:
             encoded_buf_size -= consumed_size;
 
             m_buffer.append(reinterpret_cast<const char*>(utf8_buffer.data()), utf8_buf_size);
-        } while (!m_istream->eof());
+        }
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
@@ -889,9 +1141,8 @@ private:
         std::array<uint8_t, 4> utf8_buffer {{0, 0, 0, 0}};
         uint32_t utf8_buf_size {0};
 
-        do {
-            m_istream->read(&chars[0], 4);
-            std::streamsize size = m_istream->gcount();
+        for (;;) {
+            std::size_t size = read_bytes(&chars[0], 4);
             if (size != 4) {
                 break;
             }
@@ -906,18 +1157,88 @@ private:
                 utf8::from_utf32(utf32, utf8_buffer, utf8_buf_size);
                 m_buffer.append(reinterpret_cast<const char*>(utf8_buffer.data()), utf8_buf_size);
             }
-        } while (!m_istream->eof());
+        }
 
+        FK_YAML_INSTRUMENT_COUNT(input_bytes_copied, m_buffer.size());
         return str_view {m_buffer.begin(), m_buffer.end()};
     }
 
+    /// @brief Read the next chunk from the input stream into the window buffer if all of it has been consumed.
+    /// @return true if the window buffer has unconsumed characters, false if the whole input has been consumed.
+    bool fill_window() {
+        if (m_window_pos < m_window.size()) {
+            return true;
+        }
+        if (m_is_end_of_input) {
+            return false;
+        }
+
+        m_window.resize(chunk_size);
+        m_istream->read(&m_window[0], static_cast<std::streamsize>(chunk_size));
+        std::size_t read_size = static_cast<std::size_t>(m_istream->gcount());
+        m_window.resize(read_size);
+        m_window_pos = 0;
+
+        m_is_end_of_input = (read_size == 0);
+        return !m_is_end_of_input;
+    }
+
+    /// @brief Read the next line from the input stream into the window buffer if all of it has been consumed.
+    /// @note Unlike fill_window(), this doesn't wait for a whole chunk so that lines written to pipes are available
+    /// as soon as they arrive.
+    /// @return true if the window buffer has unconsumed characters, false if the whole input has been consumed.
+    bool fill_window_line() {
+        if (m_window_pos < m_window.size()) {
+            return true;
+        }
+        if (m_is_end_of_input) {
+            return false;
+        }
+
+        m_window.clear();
+        m_window_pos = 0;
+        std::getline(*m_istream, m_window);
+        if (!m_istream->eof() && !m_istream->fail()) {
+            // std::getline() extracts the newline code but doesn't store it.
+            m_window.push_back('\n');
+        }
+
+        m_is_end_of_input = m_window.empty();
+        return !m_is_end_of_input;
+    }
+
+    /// @brief Read raw bytes from the input stream through the window buffer.
+    /// @param p_dst The destination buffer.
+    /// @param size The number of bytes to be read.
+    /// @return std::size_t The number of bytes which have actually been read.
+    std::size_t read_bytes(char* p_dst, std::size_t size) {
+        std::size_t total = 0;
+        while (total < size && fill_window()) {
+            std::size_t available = m_window.size() - m_window_pos;
+            std::size_t n = (size - total < available) ? size - total : available;
+            std::memcpy(p_dst + total, m_window.data() + m_window_pos, n);
+            m_window_pos += n;
+            total += n;
+        }
+        return total;
+    }
+
 private:
+    /// The size of a chunk read from the input stream at once.
+    static constexpr std::size_t chunk_size = 4096;
+
     /// A pointer to the input stream object.
     std::istream* m_istream {nullptr};
     /// The encoding type for this input adapter.
     utf_encode_t m_encode_type {utf_encode_t::UTF_8};
     /// The normalized owned buffer.
     std::string m_buffer {};
+    /// The window buffer which holds the last chunk read from the input.
+    std::string m_window {};
+    /// The position of the first unconsumed character in the window buffer.
+    std::size_t m_window_pos {0};
+    /// Whether the whole input has been read.
+    bool m_is_end_of_input {false};
 };
 
 /////////////////////////////////
@@ -986,7 +1307,7 @@ template <typename ContainerType>
 struct container_input_adapter_factory<
     ContainerType, void_t<decltype(begin(std::declval<ContainerType>()), end(std::declval<ContainerType>()))>> {
     /// Whether ContainerType is a contiguous container.
-    static constexpr bool is_contiguous = is_contiguous_container<ContainerType>::value;
+    static constexpr bool is_contiguous = is_contiguous_container<remove_cvref_t<ContainerType>>::value;
 
     /// A type for resulting input adapter object.
     using adapter_type = decltype(create_iterator_input_adapter(
@@ -1019,8 +1340,9 @@ inline file_input_adapter input_adapter(std::FILE* file) {
     if FK_YAML_UNLIKELY (!file) {
         throw fkyaml::exception("Invalid FILE object pointer.");
     }
-    utf_encode_t encode_type = file_utf_encode_detector::detect(file);
-    return file_input_adapter(file, encode_type);
+    std::string leading_bytes {};
+    utf_encode_t encode_type = file_utf_encode_detector::detect(file, leading_bytes);
+    return file_input_adapter(file, encode_type, std::move(leading_bytes));
 }
 
 /// @brief A factory method for stream_input_adapter objects with std::istream objects.
@@ -1030,8 +1352,9 @@ inline stream_input_adapter input_adapter(std::istream& stream) {
     if FK_YAML_UNLIKELY (!stream.good()) {
         throw fkyaml::exception("Invalid stream.");
     }
-    utf_encode_t encode_type = stream_utf_encode_detector::detect(stream);
-    return stream_input_adapter(stream, encode_type);
+    std::string leading_bytes {};
+    utf_encode_t encode_type = stream_utf_encode_detector::detect(stream, leading_bytes);
+    return stream_input_adapter(stream, encode_type, std::move(leading_bytes));
 }
 
 FK_YAML_DETAIL_NAMESPACE_END
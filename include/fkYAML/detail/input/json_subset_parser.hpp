@@ -0,0 +1,500 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_JSON_SUBSET_PARSER_HPP
+#define FK_YAML_DETAIL_INPUT_JSON_SUBSET_PARSER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/document_metainfo.hpp>
+#include <fkYAML/detail/input/key_intern_table.hpp>
+#include <fkYAML/detail/input/scalar_parser.hpp>
+#include <fkYAML/detail/input/tag_t.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/node_attrs.hpp>
+#include <fkYAML/detail/str_view.hpp>
+#include <fkYAML/detail/types/lexical_token_t.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A parser which builds YAML nodes from an input written in the JSON subset of YAML.
+/// @note This parser never reports errors on its own. It just gives up parsing if the input leaves the JSON subset so
+/// that the caller can parse the input again with the full YAML deserializer. Scalars are converted with the same
+/// scalar_parser as the full deserializer, and thus, the resulting nodes are identical to those the full deserializer
+/// would produce from the same input.
+/// @tparam BasicNodeType A type of the container for parsed YAML values.
+template <typename BasicNodeType>
+class json_subset_parser {
+    static_assert(is_basic_node<BasicNodeType>::value, "json_subset_parser only accepts basic_node<...>");
+
+    /** A type for the target basic_node. */
+    using basic_node_type = BasicNodeType;
+    /** A type for the document metainfo. */
+    using doc_metainfo_type = document_metainfo<basic_node_type>;
+    /** A type for the scalar parser. */
+    using scalar_parser_type = scalar_parser<basic_node_type>;
+    /** A type for sequence node value containers. */
+    using sequence_type = typename basic_node_type::sequence_type;
+    /** A type for mapping node value containers. */
+    using mapping_type = typename basic_node_type::mapping_type;
+    /** A type for string node values. */
+    using string_type = typename basic_node_type::string_type;
+
+public:
+    /// @brief Construct a new json_subset_parser object.
+    /// @param borrows_strings Whether string nodes may refer to the input buffer instead of owning copies of it.
+    /// @param p_key_table A table to intern mapping key strings into. (maybe null)
+    explicit json_subset_parser(bool borrows_strings = false, key_intern_table* p_key_table = nullptr) noexcept
+        : m_borrows_strings(borrows_strings),
+          mp_key_table(p_key_table) {
+    }
+
+    /// @brief Set the options for the following parse() calls.
+    /// @note This lets a parser object be reused so that its internal buffers are kept across inputs.
+    /// @param borrows_strings Whether string nodes may refer to the input buffer instead of owning copies of it.
+    /// @param p_key_table A table to intern mapping key strings into. (maybe null)
+    void set_options(bool borrows_strings, key_intern_table* p_key_table) noexcept {
+        m_borrows_strings = borrows_strings;
+        mp_key_table = p_key_table;
+    }
+
+    /// @brief Check if the given input possibly is a JSON text, i.e., begins with either `{` or `[`.
+    /// @param input The input buffer.
+    /// @return true if the input possibly is a JSON text, false otherwise.
+    static bool is_candidate(str_view input) noexcept {
+        const char* p_cur = input.begin();
+        const char* p_end = input.end();
+        while (p_cur != p_end) {
+            switch (*p_cur) {
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+                ++p_cur;
+                break;
+            case '{':
+            case '[':
+                return true;
+            default:
+                return false;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Parse the whole input as a JSON text.
+    /// @param input The input buffer.
+    /// @param root The storage for the resulting root node. Its contents are unspecified if this function fails.
+    /// @param first_line The line number of the beginning of the input buffer. (count from zero)
+    /// @return true if the whole input is parsed successfully, false if the input leaves the JSON subset.
+    bool parse(str_view input, basic_node_type& root, uint32_t first_line = 0) {
+        mp_meta = root.mp_meta;
+        m_line = first_line;
+        mp_line_begin = input.begin();
+
+        bool is_parsed = parse_value(input, root);
+
+        // release the document metainfo, but keep the capacity of the container stack for the next call.
+        mp_meta.reset();
+        m_container_stack.clear();
+        return is_parsed;
+    }
+
+private:
+    /// @brief Parse the whole input as a JSON value into the root node.
+    /// @param input The input buffer.
+    /// @param root The storage for the resulting root node.
+    /// @return true if the whole input is parsed successfully, false if the input leaves the JSON subset.
+    bool parse_value(str_view input, basic_node_type& root) {
+
+        const char* p_cur = input.begin();
+        const char* p_end = input.end();
+        skip_white_spaces(p_cur, p_end);
+        if FK_YAML_UNLIKELY (p_cur == p_end || (*p_cur != '{' && *p_cur != '[')) {
+            return false;
+        }
+
+        basic_node_type* p_target = &root;
+
+        for (;;) {
+            // parse a value into the target node.
+            switch (*p_cur) {
+            case '[':
+                *p_target = create_node(node_type::SEQUENCE);
+                m_container_stack.push_back(p_target);
+                skip_white_spaces(++p_cur, p_end);
+                if FK_YAML_UNLIKELY (p_cur == p_end) {
+                    return false;
+                }
+                if (*p_cur == ']') {
+                    ++p_cur;
+                    m_container_stack.pop_back();
+                    break;
+                }
+                p_target = &add_sequence_entry(*p_target);
+                continue;
+            case '{':
+                *p_target = create_node(node_type::MAPPING);
+                m_container_stack.push_back(p_target);
+                skip_white_spaces(++p_cur, p_end);
+                if FK_YAML_UNLIKELY (p_cur == p_end) {
+                    return false;
+                }
+                if (*p_cur == '}') {
+                    ++p_cur;
+                    m_container_stack.pop_back();
+                    break;
+                }
+                p_target = add_mapping_entry(*p_target, p_cur, p_end);
+                if FK_YAML_UNLIKELY (!p_target) {
+                    return false;
+                }
+                continue;
+            case '\"':
+                if FK_YAML_UNLIKELY (!parse_string(p_cur, p_end, *p_target, m_borrows_strings)) {
+                    return false;
+                }
+                break;
+            default:
+                if FK_YAML_UNLIKELY (!parse_literal(p_cur, p_end, *p_target)) {
+                    return false;
+                }
+                break;
+            }
+
+            // close the containers which have been completed, or move to the next entry.
+            for (;;) {
+                skip_white_spaces(p_cur, p_end);
+                if (m_container_stack.empty()) {
+                    // only white spaces are allowed after the root value.
+                    return p_cur == p_end;
+                }
+                if FK_YAML_UNLIKELY (p_cur == p_end) {
+                    return false;
+                }
+
+                basic_node_type& container = *m_container_stack.back();
+                bool is_sequence = container.is_sequence();
+                if (*p_cur == ',') {
+                    skip_white_spaces(++p_cur, p_end);
+                    if FK_YAML_UNLIKELY (p_cur == p_end) {
+                        return false;
+                    }
+                    p_target =
+                        is_sequence ? &add_sequence_entry(container) : add_mapping_entry(container, p_cur, p_end);
+                    break;
+                }
+                if FK_YAML_UNLIKELY (*p_cur != (is_sequence ? ']' : '}')) {
+                    return false;
+                }
+                ++p_cur;
+                m_container_stack.pop_back();
+            }
+
+            if FK_YAML_UNLIKELY (!p_target) {
+                return false;
+            }
+        }
+    }
+
+    /// @brief Create a node of the given type which shares the metainfo of the resulting document.
+    /// @param type A YAML node type.
+    /// @return basic_node_type The created node.
+    basic_node_type create_node(node_type type = node_type::NULL_OBJECT) const {
+        return basic_node_type(type, mp_meta);
+    }
+
+    /// @brief Skip JSON white spaces while counting lines.
+    /// @param p_cur The current position in the input buffer, which will be moved past white spaces.
+    /// @param p_end The end of the input buffer.
+    void skip_white_spaces(const char*& p_cur, const char* p_end) noexcept {
+        for (; p_cur != p_end; ++p_cur) {
+            switch (*p_cur) {
+            case '\n':
+                ++m_line;
+                mp_line_begin = p_cur + 1;
+                break;
+            case ' ':
+            case '\t':
+            case '\r':
+                break;
+            default:
+                return;
+            }
+        }
+    }
+
+    /// @brief Add a new entry to the sequence node.
+    /// @param seq A sequence node.
+    /// @return basic_node_type& The added entry.
+    basic_node_type& add_sequence_entry(basic_node_type& seq) {
+        auto& seq_val = seq.template get_value_ref<sequence_type&>();
+        seq_val.emplace_back(create_node());
+        return seq_val.back();
+    }
+
+    /// @brief Parse a key and the following colon, and then add a new entry to the mapping node.
+    /// @param map A mapping node.
+    /// @param p_cur The current position in the input buffer, which must point to the beginning of a key.
+    /// @param p_end The end of the input buffer.
+    /// @return basic_node_type* The value of the added entry, or nullptr if the key is invalid or duplicate.
+    basic_node_type* add_mapping_entry(basic_node_type& map, const char*& p_cur, const char* p_end) {
+        if FK_YAML_UNLIKELY (*p_cur != '\"') {
+            return nullptr;
+        }
+
+        // while mapping keys are interned, keys refer to the input buffer until they are interned.
+        basic_node_type key = create_node();
+        if FK_YAML_UNLIKELY (!parse_string(p_cur, p_end, key, m_borrows_strings || mp_key_table)) {
+            return nullptr;
+        }
+        intern_key(key);
+
+        skip_white_spaces(p_cur, p_end);
+        if FK_YAML_UNLIKELY (p_cur == p_end || *p_cur != ':') {
+            return nullptr;
+        }
+        skip_white_spaces(++p_cur, p_end);
+        if FK_YAML_UNLIKELY (p_cur == p_end) {
+            return nullptr;
+        }
+
+        auto itr = map.template get_value_ref<mapping_type&>().emplace(std::move(key), create_node());
+        if FK_YAML_UNLIKELY (!itr.second) {
+            // let the full deserializer report the duplication.
+            return nullptr;
+        }
+        return &(itr.first->second);
+    }
+
+    /// @brief Replace the string value of a mapping key node with the interned one if mapping keys are interned.
+    /// @param key A mapping key node which is a string node.
+    void intern_key(basic_node_type& key) {
+        str_view interned {};
+        if (mp_key_table && mp_key_table->intern(key.template get_value<str_view>(), interned)) {
+            external_node_constructor<node_type::STRING>::construct_borrowed(key, interned);
+        }
+        else if (!m_borrows_strings && (key.m_attrs & node_attr_bits::borrowed_str_bit)) {
+            // the key refers to the input buffer only while mapping keys are interned.
+            key.template get_value_ref<string_type&>();
+        }
+    }
+
+    /// @brief Parse a JSON string into a string node.
+    /// @param p_cur The current position in the input buffer, which must point to the opening double quote.
+    /// @param p_end The end of the input buffer.
+    /// @param node The storage for the resulting node.
+    /// @param borrows_strings Whether the resulting node may refer to the input buffer.
+    /// @return true if a JSON string is parsed successfully, false otherwise.
+    bool parse_string(const char*& p_cur, const char* p_end, basic_node_type& node, bool borrows_strings) {
+        const char* p_begin = ++p_cur;
+        for (; p_cur != p_end; ++p_cur) {
+            const auto c = static_cast<uint8_t>(*p_cur);
+            if (c == '\"') {
+                break;
+            }
+            if FK_YAML_UNLIKELY (c < 0x20u) {
+                // raw control characters (including line breaks) are not allowed in JSON strings.
+                return false;
+            }
+            if (c == '\\') {
+                if FK_YAML_UNLIKELY (++p_cur == p_end) {
+                    return false;
+                }
+                switch (*p_cur) {
+                case '\"':
+                case '\\':
+                case '/':
+                case 'b':
+                case 'f':
+                case 'n':
+                case 'r':
+                case 't':
+                    break;
+                case 'u':
+                    if FK_YAML_UNLIKELY (p_end - p_cur <= 4) {
+                        return false;
+                    }
+                    for (int i = 0; i < 4; i++) {
+                        if FK_YAML_UNLIKELY (!is_hex_digit(*++p_cur)) {
+                            return false;
+                        }
+                    }
+                    break;
+                default:
+                    // YAML-specific escape sequences are left to the full deserializer.
+                    return false;
+                }
+            }
+        }
+
+        if FK_YAML_UNLIKELY (p_cur == p_end) {
+            return false;
+        }
+
+        str_view token(p_begin, p_cur);
+        node = scalar_parser_type(m_line, get_indent(p_begin - 1), borrows_strings, mp_meta)
+                   .parse_flow(lexical_token_t::DOUBLE_QUOTED_SCALAR, tag_t::NONE, token);
+        ++p_cur; // skip the closing double quote.
+        return true;
+    }
+
+    /// @brief Parse a JSON literal (true, false, null or a number) into a scalar node.
+    /// @param p_cur The current position in the input buffer, which must point to the beginning of a literal.
+    /// @param p_end The end of the input buffer.
+    /// @param node The storage for the resulting node.
+    /// @return true if a JSON literal is parsed successfully, false otherwise.
+    bool parse_literal(const char*& p_cur, const char* p_end, basic_node_type& node) {
+        const char* p_begin = p_cur;
+        switch (*p_cur) {
+        case 't':
+            if FK_YAML_UNLIKELY (!skip_keyword(p_cur, p_end, "true", 4)) {
+                return false;
+            }
+            break;
+        case 'f':
+            if FK_YAML_UNLIKELY (!skip_keyword(p_cur, p_end, "false", 5)) {
+                return false;
+            }
+            break;
+        case 'n':
+            if FK_YAML_UNLIKELY (!skip_keyword(p_cur, p_end, "null", 4)) {
+                return false;
+            }
+            break;
+        default:
+            if FK_YAML_UNLIKELY (!skip_number(p_cur, p_end)) {
+                return false;
+            }
+            break;
+        }
+
+        // a literal must be followed by a white space, a separator or a flow suffix.
+        if (p_cur != p_end) {
+            switch (*p_cur) {
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+            case ',':
+            case ']':
+            case '}':
+                break;
+            default:
+                return false;
+            }
+        }
+
+        str_view token(p_begin, p_cur);
+        node = scalar_parser_type(m_line, get_indent(p_begin), m_borrows_strings, mp_meta)
+                   .parse_flow(lexical_token_t::PLAIN_SCALAR, tag_t::NONE, token);
+        return true;
+    }
+
+    /// @brief Skip the given keyword if the input buffer begins with it.
+    /// @param p_cur The current position in the input buffer.
+    /// @param p_end The end of the input buffer.
+    /// @param keyword The keyword to be skipped.
+    /// @param len The length of the keyword.
+    /// @return true if the keyword is skipped, false otherwise.
+    static bool skip_keyword(const char*& p_cur, const char* p_end, const char* keyword, std::size_t len) noexcept {
+        if (static_cast<std::size_t>(p_end - p_cur) < len || std::char_traits<char>::compare(p_cur, keyword, len)) {
+            return false;
+        }
+        p_cur += len;
+        return true;
+    }
+
+    /// @brief Skip a number which conforms to the JSON number grammar.
+    /// @param p_cur The current position in the input buffer.
+    /// @param p_end The end of the input buffer.
+    /// @return true if a number is skipped, false otherwise.
+    static bool skip_number(const char*& p_cur, const char* p_end) noexcept {
+        if (*p_cur == '-') {
+            ++p_cur;
+        }
+
+        // integer part
+        if (p_cur == p_end) {
+            return false;
+        }
+        if (*p_cur == '0') {
+            ++p_cur;
+        }
+        else if (!skip_digits(p_cur, p_end)) {
+            return false;
+        }
+
+        // fraction part
+        if (p_cur != p_end && *p_cur == '.') {
+            if (!skip_digits(++p_cur, p_end)) {
+                return false;
+            }
+        }
+
+        // exponent part
+        if (p_cur != p_end && (*p_cur == 'e' || *p_cur == 'E')) {
+            if (++p_cur != p_end && (*p_cur == '+' || *p_cur == '-')) {
+                ++p_cur;
+            }
+            if (!skip_digits(p_cur, p_end)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// @brief Skip one or more decimal digits.
+    /// @param p_cur The current position in the input buffer.
+    /// @param p_end The end of the input buffer.
+    /// @return true if at least one digit is skipped, false otherwise.
+    static bool skip_digits(const char*& p_cur, const char* p_end) noexcept {
+        const char* p_begin = p_cur;
+        while (p_cur != p_end && '0' <= *p_cur && *p_cur <= '9') {
+            ++p_cur;
+        }
+        return p_cur != p_begin;
+    }
+
+    /// @brief Check if the given character is a hexadecimal digit.
+    /// @param c A character.
+    /// @return true if the character is a hexadecimal digit, false otherwise.
+    static bool is_hex_digit(char c) noexcept {
+        return ('0' <= c && c <= '9') || ('A' <= c && c <= 'F') || ('a' <= c && c <= 'f');
+    }
+
+    /// @brief Get the column of the given position in the current line.
+    /// @param p_pos A position in the current line.
+    /// @return uint32_t The column of the position. (count from zero)
+    uint32_t get_indent(const char* p_pos) const noexcept {
+        return static_cast<uint32_t>(p_pos - mp_line_begin);
+    }
+
+private:
+    /// The stack of the pointers to unclosed container nodes.
+    std::vector<basic_node_type*> m_container_stack {};
+    /// The document metainfo shared by all the resulting nodes.
+    std::shared_ptr<doc_metainfo_type> mp_meta {};
+    /// The current line. (count from zero)
+    uint32_t m_line {0};
+    /// The beginning of the current line.
+    const char* mp_line_begin {nullptr};
+    /// Whether string nodes may refer to the input buffer.
+    bool m_borrows_strings {false};
+    /// The table to intern mapping key strings into. (maybe null)
+    key_intern_table* mp_key_table {nullptr};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_JSON_SUBSET_PARSER_HPP */
@@ -0,0 +1,119 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_KEY_INTERN_TABLE_HPP
+#define FK_YAML_DETAIL_INPUT_KEY_INTERN_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <unordered_set>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/str_view.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A table of mapping key strings shared by YAML documents so that each distinct key is stored only once.
+/// @note The stored strings are immutable and never move until the table is destroyed, and thus, string nodes can
+/// refer to them as long as they keep the table alive. This class is not thread-safe.
+class key_intern_table {
+    /// @brief A hash function object for str_view objects. (FNV-1a)
+    struct str_view_hash {
+        /// @brief Compute the hash value of the given string.
+        /// @param s A string.
+        /// @return std::size_t The hash value.
+        std::size_t operator()(str_view s) const noexcept {
+            uint64_t hash = 14695981039346656037ull;
+            for (char c : s) {
+                hash ^= static_cast<uint8_t>(c);
+                hash *= 1099511628211ull;
+            }
+            return static_cast<std::size_t>(hash);
+        }
+    };
+
+public:
+    /// The default maximum number of distinct keys.
+    static constexpr std::size_t default_max_size = 4096;
+
+    /// @brief Construct a new key_intern_table object.
+    /// @param max_size The maximum number of distinct keys. Keys are no longer interned once the table is full so that
+    /// the table doesn't grow without limit with inputs whose keys are unique, e.g., IDs.
+    explicit key_intern_table(std::size_t max_size = default_max_size)
+        : m_max_size(max_size) {
+    }
+
+    // the interned strings are referred to by string nodes, so the table can be neither copied nor moved.
+    key_intern_table(const key_intern_table&) = delete;
+    key_intern_table(key_intern_table&&) = delete;
+    key_intern_table& operator=(const key_intern_table&) = delete;
+    key_intern_table& operator=(key_intern_table&&) = delete;
+    ~key_intern_table() = default;
+
+    /// @brief Get the interned string equal to the given key, adding a new one if the table has no such string.
+    /// @param key A mapping key string.
+    /// @param interned The storage for the view into the interned string.
+    /// @return true if the key has been interned, false if the table is full or the key is too long.
+    bool intern(str_view key, str_view& interned) {
+        auto itr = m_index.find(key);
+        if FK_YAML_LIKELY (itr != m_index.end()) {
+            interned = *itr;
+            return true;
+        }
+
+        if (m_index.size() >= m_max_size || key.size() > std::numeric_limits<uint32_t>::max()) {
+            return false;
+        }
+
+        m_storage.emplace_back(key.begin(), key.end());
+        interned = str_view(m_storage.back());
+        m_index.insert(interned);
+        return true;
+    }
+
+    /// @brief Get the number of distinct keys in this table.
+    /// @return std::size_t The number of distinct keys.
+    std::size_t size() const noexcept {
+        return m_index.size();
+    }
+
+    /// @brief Get the approximate bytes of memory allocated by this table, excluding the table object itself.
+    /// @note Bookkeeping data of the memory allocator and the hash table nodes are estimated.
+    /// @return std::size_t The approximate bytes of memory allocated by this table.
+    std::size_t memory_usage() const noexcept {
+        // strings longer than this are allocated on the heap. (small string optimization)
+        const std::size_t sso_capacity = std::string().capacity();
+
+        std::size_t bytes = m_storage.size() * sizeof(std::string);
+        for (const auto& s : m_storage) {
+            if (s.capacity() > sso_capacity) {
+                bytes += s.capacity() + 1;
+            }
+        }
+
+        // each hash table node holds the next pointer and the element, and each bucket holds a pointer.
+        bytes += m_index.size() * (sizeof(void*) + sizeof(str_view));
+        bytes += m_index.bucket_count() * sizeof(void*);
+        return bytes;
+    }
+
+private:
+    /// The maximum number of distinct keys.
+    std::size_t m_max_size {default_max_size};
+    /// The interned strings. (std::deque never moves existing elements on insertion.)
+    std::deque<std::string> m_storage {};
+    /// The views into the interned strings for lookups.
+    std::unordered_set<str_view, str_view_hash> m_index {};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_KEY_INTERN_TABLE_HPP */
@@ -19,6 +19,7 @@
 #include <fkYAML/detail/encodings/utf_encodings.hpp>
 #include <fkYAML/detail/input/block_scalar_header.hpp>
 #include <fkYAML/detail/input/position_tracker.hpp>
+#include <fkYAML/detail/instrumentation.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
 #include <fkYAML/detail/str_view.hpp>
 #include <fkYAML/detail/types/lexical_token_t.hpp>
@@ -48,16 +49,21 @@ class lexical_analyzer {
 public:
     /// @brief Construct a new lexical_analyzer object.
     /// @param input_buffer An input buffer.
-    explicit lexical_analyzer(str_view input_buffer) noexcept
+    /// @param first_line The line number of the beginning of the input buffer. (count from zero)
+    explicit lexical_analyzer(str_view input_buffer, uint32_t first_line = 0) noexcept
         : m_input_buffer(input_buffer),
           m_cur_itr(m_input_buffer.begin()),
-          m_end_itr(m_input_buffer.end()) {
-        m_pos_tracker.set_target_buffer(m_input_buffer);
+          m_end_itr(m_input_buffer.end()),
+          m_last_token_begin_line(first_line) {
+        m_pos_tracker.set_target_buffer(m_input_buffer, first_line);
     }
 
     /// @brief Get the next lexical token by scanning the left of the input buffer.
     /// @return lexical_token The next lexical token.
     lexical_token get_next_token() {
+        FK_YAML_INSTRUMENT_PHASE(LEXING);
+        FK_YAML_INSTRUMENT_COUNT(num_tokens, 1);
+
         skip_white_spaces_and_newline_codes();
 
         m_token_begin_itr = m_cur_itr;
@@ -260,6 +266,12 @@ public:
         return m_last_token_begin_line;
     }
 
+    /// @brief Get the input which has not been processed yet.
+    /// @return str_view The rest of the input after the last token.
+    str_view get_unprocessed_input() const noexcept {
+        return str_view {m_cur_itr, m_end_itr};
+    }
+
     /// @brief Get the YAML version specification.
     /// @return str_view A YAML version specification.
     str_view get_yaml_version() const noexcept {
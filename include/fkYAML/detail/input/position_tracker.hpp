@@ -19,9 +19,13 @@ FK_YAML_DETAIL_NAMESPACE_BEGIN
 /// @brief A position tracker of the target buffer.
 class position_tracker {
 public:
-    void set_target_buffer(str_view buffer) noexcept {
+    /// @brief Set the target buffer whose positions are tracked.
+    /// @param buffer The target buffer.
+    /// @param first_line The line number of the beginning of the buffer. (count from zero)
+    void set_target_buffer(str_view buffer, uint32_t first_line = 0) noexcept {
         m_begin = m_last = buffer.begin();
         m_end = buffer.end();
+        m_lines_read = first_line;
     }
 
     /// @brief Update the set of the current position information.
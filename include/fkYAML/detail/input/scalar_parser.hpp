@@ -9,13 +9,19 @@
 #ifndef FK_YAML_DETAIL_INPUT_SCALAR_PARSER_HPP
 #define FK_YAML_DETAIL_INPUT_SCALAR_PARSER_HPP
 
+#include <limits>
+#include <memory>
+
 #include <fkYAML/detail/macros/version_macros.hpp>
 #include <fkYAML/detail/assert.hpp>
 #include <fkYAML/detail/conversions/scalar_conv.hpp>
+#include <fkYAML/detail/conversions/to_node.hpp>
+#include <fkYAML/detail/document_metainfo.hpp>
 #include <fkYAML/detail/encodings/yaml_escaper.hpp>
 #include <fkYAML/detail/input/block_scalar_header.hpp>
 #include <fkYAML/detail/input/scalar_scanner.hpp>
 #include <fkYAML/detail/input/tag_t.hpp>
+#include <fkYAML/detail/instrumentation.hpp>
 #include <fkYAML/detail/meta/node_traits.hpp>
 #include <fkYAML/detail/str_view.hpp>
 #include <fkYAML/detail/types/lexical_token_t.hpp>
@@ -32,6 +38,9 @@ class scalar_parser {
 
 public:
     using basic_node_type = BasicNodeType;
+    /** A type for numeric values converted while scalar value types are detected. */
+    using scanned_number_type =
+        scanned_number<typename basic_node_type::integer_type, typename basic_node_type::float_number_type>;
 
 private:
     /** A type for boolean node values. */
@@ -42,14 +51,23 @@ private:
     using float_number_type = typename basic_node_type::float_number_type;
     /** A type for string node values. */
     using string_type = typename basic_node_type::string_type;
+    /** A type for the document metainfo. */
+    using doc_metainfo_type = document_metainfo<basic_node_type>;
 
 public:
     /// @brief Constructs a new scalar_parser object.
     /// @param line Current line.
     /// @param indent Current indentation.
-    scalar_parser(uint32_t line, uint32_t indent) noexcept
+    /// @param borrows_strings Whether string nodes may refer to the input buffer instead of owning copies of it.
+    /// @param p_meta The metainfo of the document which the resulting nodes belong to. If null, each resulting node
+    /// has its own metainfo.
+    scalar_parser(
+        uint32_t line, uint32_t indent, bool borrows_strings = false,
+        std::shared_ptr<doc_metainfo_type> p_meta = nullptr) noexcept
         : m_line(line),
-          m_indent(indent) {
+          m_indent(indent),
+          m_borrows_strings(borrows_strings),
+          mp_meta(std::move(p_meta)) {
     }
 
     /// @brief Destroys a scalar_parser object.
@@ -72,10 +90,11 @@ public:
             lex_type == lexical_token_t::PLAIN_SCALAR || lex_type == lexical_token_t::SINGLE_QUOTED_SCALAR ||
             lex_type == lexical_token_t::DOUBLE_QUOTED_SCALAR);
         FK_YAML_ASSERT(tag_type != tag_t::SEQUENCE && tag_type != tag_t::MAPPING);
+        FK_YAML_INSTRUMENT_PHASE(SCALAR_CONVERSION);
 
-        token = parse_flow_scalar_token(lex_type, token);
-        node_type value_type = decide_value_type(lex_type, tag_type, token);
-        return create_scalar_node(value_type, token);
+        scanned_number_type number {};
+        node_type value_type = parse_flow_contents(lex_type, tag_type, token, number);
+        return create_scalar_node(value_type, token, number);
     }
 
     /// @brief Parses a token into a block scalar (either literal or folded)
@@ -89,6 +108,45 @@ public:
         FK_YAML_ASSERT(
             lex_type == lexical_token_t::BLOCK_LITERAL_SCALAR || lex_type == lexical_token_t::BLOCK_FOLDED_SCALAR);
         FK_YAML_ASSERT(tag_type != tag_t::SEQUENCE && tag_type != tag_t::MAPPING);
+        FK_YAML_INSTRUMENT_PHASE(SCALAR_CONVERSION);
+
+        scanned_number_type number {};
+        node_type value_type = parse_block_contents(lex_type, tag_type, token, header, number);
+        return create_scalar_node(value_type, token, number);
+    }
+
+    /// @brief Parses a token into flow scalar contents and detects its value type without creating a node.
+    /// @note The resulting contents may refer to the internal buffer of this parser, and thus, is valid only until the
+    /// next call on this parser.
+    /// @param lex_type Lexical token type for the scalar.
+    /// @param tag_type Tag type for the scalar.
+    /// @param token Scalar contents. Replaced with the parsed contents.
+    /// @param number The storage for the numeric value converted on the way if any.
+    /// @return node_type The value type of the scalar.
+    node_type parse_flow_contents(
+        lexical_token_t lex_type, tag_t tag_type, str_view& token, scanned_number_type& number) {
+        FK_YAML_ASSERT(
+            lex_type == lexical_token_t::PLAIN_SCALAR || lex_type == lexical_token_t::SINGLE_QUOTED_SCALAR ||
+            lex_type == lexical_token_t::DOUBLE_QUOTED_SCALAR);
+
+        token = parse_flow_scalar_token(lex_type, token);
+        return decide_value_type(lex_type, tag_type, token, number);
+    }
+
+    /// @brief Parses a token into block scalar contents and detects its value type without creating a node.
+    /// @note The resulting contents may refer to the internal buffer of this parser, and thus, is valid only until the
+    /// next call on this parser.
+    /// @param lex_type Lexical token type for the scalar.
+    /// @param tag_type Tag type for the scalar.
+    /// @param token Scalar contents. Replaced with the parsed contents.
+    /// @param header Block scalar header information.
+    /// @param number The storage for the numeric value converted on the way if any.
+    /// @return node_type The value type of the scalar.
+    node_type parse_block_contents(
+        lexical_token_t lex_type, tag_t tag_type, str_view& token, const block_scalar_header& header,
+        scanned_number_type& number) {
+        FK_YAML_ASSERT(
+            lex_type == lexical_token_t::BLOCK_LITERAL_SCALAR || lex_type == lexical_token_t::BLOCK_FOLDED_SCALAR);
 
         if (lex_type == lexical_token_t::BLOCK_LITERAL_SCALAR) {
             token = parse_block_literal_scalar(token, header);
@@ -96,9 +154,7 @@ public:
         else {
             token = parse_block_folded_scalar(token, header);
         }
-
-        node_type value_type = decide_value_type(lex_type, tag_type, token);
-        return create_scalar_node(value_type, token);
+        return decide_value_type(lex_type, tag_type, token, number);
     }
 
 private:
@@ -163,6 +219,7 @@ private:
             m_buffer.append(token.begin(), token.size());
         }
 
+        FK_YAML_INSTRUMENT_COUNT(scalar_bytes_copied, m_buffer.size());
         return {m_buffer};
     }
 
@@ -198,6 +255,7 @@ private:
                     token.remove_prefix(pos);
                     const char* p_escape_begin = token.begin();
                     bool is_valid_escaping = yaml_escaper::unescape(p_escape_begin, token.end(), m_buffer);
+                    FK_YAML_INSTRUMENT_COUNT(num_unescapes, 1);
                     if FK_YAML_UNLIKELY (!is_valid_escaping) {
                         throw parse_error(
                             "Unsupported escape sequence is found in a double quoted scalar.", m_line, m_indent);
@@ -225,6 +283,7 @@ private:
             m_buffer.append(token.begin(), token.size());
         }
 
+        FK_YAML_INSTRUMENT_COUNT(scalar_bytes_copied, m_buffer.size());
         return {m_buffer};
     }
 
@@ -266,6 +325,7 @@ private:
 
         process_chomping(header.chomp);
 
+        FK_YAML_INSTRUMENT_COUNT(scalar_bytes_copied, m_buffer.size());
         return {m_buffer};
     }
 
@@ -340,6 +400,7 @@ private:
 
         process_chomping(header.chomp);
 
+        FK_YAML_INSTRUMENT_COUNT(scalar_bytes_copied, m_buffer.size());
         return {m_buffer};
     }
 
@@ -431,12 +492,15 @@ private:
     /// @param lex_type Lexical token type for the scalar.
     /// @param tag_type Tag type for the scalar.
     /// @param token Scalar contents.
+    /// @param number The output holder of the numeric value converted while the contents are scanned.
     /// @return Scalar value type.
-    node_type decide_value_type(lexical_token_t lex_type, tag_t tag_type, str_view token) const noexcept {
+    node_type decide_value_type(
+        lexical_token_t lex_type, tag_t tag_type, str_view token, scanned_number_type& number) const noexcept {
         node_type value_type {node_type::STRING};
         if (lex_type == lexical_token_t::PLAIN_SCALAR) {
-            value_type = scalar_scanner::scan(token.begin(), token.end());
+            value_type = scalar_scanner::scan(token.begin(), token.end(), number);
         }
+        const node_type scanned_type = value_type;
 
         switch (tag_type) {
         case tag_t::NULL_VALUE:
@@ -465,15 +529,21 @@ private:
             break;
         }
 
+        if (value_type != scanned_type) {
+            // the converted value, if any, is of the type which has been overridden by the tag.
+            number.is_converted = false;
+        }
+
         return value_type;
     }
 
     /// @brief Creates YAML scalar object based on the value type and contents.
     /// @param type Scalar value type.
     /// @param token Scalar contents.
+    /// @param number The numeric value which has already been converted from the contents if any.
     /// @return A YAML scalar object.
-    basic_node_type create_scalar_node(node_type type, str_view token) {
-        basic_node_type node {};
+    basic_node_type create_scalar_node(node_type type, str_view token, const scanned_number_type& number) {
+        basic_node_type node = mp_meta ? basic_node_type(node_type::NULL_OBJECT, mp_meta) : basic_node_type();
 
         switch (type) {
         case node_type::NULL_OBJECT: {
@@ -491,34 +561,48 @@ private:
             if FK_YAML_UNLIKELY (!converted) {
                 throw parse_error("Failed to convert a scalar to a boolean.", m_line, m_indent);
             }
-            node = basic_node_type(boolean);
+            external_node_constructor<node_type::BOOLEAN>::construct(node, boolean);
             break;
         }
         case node_type::INTEGER: {
+            if (number.is_converted) {
+                external_node_constructor<node_type::INTEGER>::construct(node, number.integer);
+                break;
+            }
+
             integer_type integer = 0;
             bool converted = detail::atoi(token.begin(), token.end(), integer);
             if FK_YAML_UNLIKELY (!converted) {
                 throw parse_error("Failed to convert a scalar to an integer.", m_line, m_indent);
             }
-            node = basic_node_type(integer);
+            external_node_constructor<node_type::INTEGER>::construct(node, integer);
             break;
         }
         case node_type::FLOAT: {
+            if (number.is_converted) {
+                external_node_constructor<node_type::FLOAT>::construct(node, number.float_number);
+                break;
+            }
+
             float_number_type float_val = 0;
             bool converted = detail::atof(token.begin(), token.end(), float_val);
             if FK_YAML_UNLIKELY (!converted) {
                 throw parse_error("Failed to convert a scalar to a floating point value", m_line, m_indent);
             }
-            node = basic_node_type(float_val);
+            external_node_constructor<node_type::FLOAT>::construct(node, float_val);
             break;
         }
         case node_type::STRING:
             if (m_use_owned_buffer) {
-                node = basic_node_type(std::move(m_buffer));
+                external_node_constructor<node_type::STRING>::construct(node, std::move(m_buffer));
                 m_use_owned_buffer = false;
             }
+            else if (m_borrows_strings && !token.empty() && token.size() <= std::numeric_limits<uint32_t>::max()) {
+                // the contents need no mutation and thus are still a part of the input buffer.
+                external_node_constructor<node_type::STRING>::construct_borrowed(node, token);
+            }
             else {
-                node = basic_node_type(std::string(token.begin(), token.end()));
+                external_node_constructor<node_type::STRING>::construct(node, std::string(token.begin(), token.end()));
             }
             break;
         default:   // LCOV_EXCL_LINE
@@ -532,6 +616,10 @@ private:
     uint32_t m_line {0};
     /// Current indentation for the scalar
     uint32_t m_indent {0};
+    /// Whether string nodes may refer to the input buffer.
+    bool m_borrows_strings {false};
+    /// The metainfo of the document which the resulting nodes belong to. (maybe null)
+    std::shared_ptr<doc_metainfo_type> mp_meta {};
     /// Whether the parsed contents are stored in an owned buffer.
     bool m_use_owned_buffer {false};
     /// Owned buffer storage for parsing. This buffer is used when scalar contents need mutation.
@@ -9,11 +9,15 @@
 #ifndef FK_YAML_DETAIL_INPUT_SCALAR_SCANNER_HPP
 #define FK_YAML_DETAIL_INPUT_SCALAR_SCANNER_HPP
 
+#include <cstdint>
 #include <cstring>
+#include <limits>
 #include <string>
 
 #include <fkYAML/detail/macros/version_macros.hpp>
 #include <fkYAML/detail/assert.hpp>
+#include <fkYAML/detail/conversions/float_parser.hpp>
+#include <fkYAML/detail/conversions/scalar_conv.hpp>
 #include <fkYAML/node_type.hpp>
 
 FK_YAML_DETAIL_NAMESPACE_BEGIN
@@ -38,6 +42,19 @@ inline bool is_xdigit(char c) {
 
 } // namespace
 
+/// @brief A numeric value converted from a scalar while its value type is detected.
+/// @tparam IntegerType The type of integer values.
+/// @tparam FloatType The type of floating point values.
+template <typename IntegerType, typename FloatType>
+struct scanned_number {
+    /// Whether the scalar has been converted into the value of the detected type.
+    bool is_converted {false};
+    /// The converted integer value. (valid only if the scalar is detected as an integer)
+    IntegerType integer {0};
+    /// The converted floating point value. (valid only if the scalar is detected as a floating point value)
+    FloatType float_number {0};
+};
+
 /// @brief The class which detects a scalar value type by scanning contents.
 class scalar_scanner {
 public:
@@ -125,7 +142,159 @@ public:
         return scan_possible_number_token(begin, len);
     }
 
+    /// @brief Detects a scalar value type and converts the scalar in the same pass if it is a decimal number.
+    /// @note The detected type is always the same as the one the above scan() function returns. Numbers which cannot be
+    /// converted on the way, e.g., octal/hexadecimal integers, infinities, out-of-range values or floating point values
+    /// with more than 19 significant digits, are left unconverted with `number.is_converted` being false.
+    /// @tparam IntegerType The type of integer values.
+    /// @tparam FloatType The type of floating point values.
+    /// @param begin The iterator to the first element of the scalar.
+    /// @param end The iterator to the past-the-end element of the scalar.
+    /// @param number The output numeric value holder.
+    /// @return A detected scalar value type.
+    template <typename IntegerType, typename FloatType>
+    static node_type scan(
+        const char* begin, const char* end, scanned_number<IntegerType, FloatType>& number) noexcept {
+        number.is_converted = false;
+
+        const char* p_cur = begin;
+        bool is_negative = (p_cur != end && *p_cur == '-');
+        bool has_sign = is_negative || (p_cur != end && *p_cur == '+');
+        if (has_sign) {
+            ++p_cur;
+        }
+
+        // Overflow is harmless here since the mantissa is used only if it has no more digits than max_mantissa_digits.
+        uint64_t mantissa = 0;
+        const char* p_int_begin = p_cur;
+        p_cur = accumulate_digits(p_cur, end, mantissa);
+        std::size_t num_digits = static_cast<std::size_t>(p_cur - p_int_begin);
+
+        bool is_decimal_number_begin = (num_digits == 0) ? (p_cur != end && *p_cur == '.')
+                                                         : (num_digits == 1 || has_sign || *p_int_begin != '0');
+        if (!is_decimal_number_begin) {
+            // e.g., null, booleans, strings, octal/hexadecimal integers or decimals beginning with 0 like `0123`.
+            return scan(begin, end);
+        }
+
+        if (p_cur == end) {
+            // atoi() rejects integers with more digits than the maximum value has even if they begin with zeros.
+            using int_limits_type = std::numeric_limits<IntegerType>;
+            const std::size_t max_int_digits = static_cast<std::size_t>(int_limits_type::digits10) + 1;
+            if (num_digits <= max_mantissa_digits && num_digits <= max_int_digits) {
+                number.is_converted = convert_integer(mantissa, is_negative, number.integer);
+            }
+            return node_type::INTEGER;
+        }
+
+        int32_t exponent = 0;
+        if (*p_cur == '.') {
+            const char* p_frac_begin = ++p_cur;
+            p_cur = accumulate_digits(p_cur, end, mantissa);
+
+            std::size_t frac_len = static_cast<std::size_t>(p_cur - p_frac_begin);
+            if (num_digits + frac_len == 0) {
+                // e.g., `.` or `.inf`
+                return scan(begin, end);
+            }
+            num_digits += frac_len;
+            if (num_digits <= max_mantissa_digits) {
+                exponent = -static_cast<int32_t>(frac_len);
+            }
+        }
+
+        if (p_cur != end) {
+            if (*p_cur != 'e' && *p_cur != 'E') {
+                return scan(begin, end);
+            }
+            ++p_cur;
+
+            bool is_exponent_negative = (p_cur != end && *p_cur == '-');
+            if (p_cur != end && (*p_cur == '-' || *p_cur == '+')) {
+                ++p_cur;
+            }
+
+            const char* p_exp_begin = p_cur;
+            int32_t exp_value = 0;
+            while (p_cur != end && is_digit(*p_cur)) {
+                // any exponent this large makes the value overflow or underflow.
+                if (exp_value < 10000) {
+                    exp_value = exp_value * 10 + (*p_cur - '0');
+                }
+                ++p_cur;
+            }
+
+            if (p_cur == p_exp_begin || p_cur != end) {
+                return scan(begin, end);
+            }
+            exponent += is_exponent_negative ? -exp_value : exp_value;
+        }
+
+        if (num_digits <= max_mantissa_digits) {
+            number.is_converted = decimal_to_float(mantissa, exponent, is_negative, number.float_number);
+        }
+        return node_type::FLOAT;
+    }
+
 private:
+    /// @brief Accumulates the leading decimal digits into the given value, 8 digits at a time while possible.
+    /// @param p_begin The pointer to the first element of the digits.
+    /// @param p_end The pointer to the past-the-end element of the scalar.
+    /// @param value The value into which the digits are accumulated. It may overflow with more than 19 digits.
+    /// @return const char* The pointer to the first non-digit element or `p_end`.
+    static const char* accumulate_digits(const char* p_begin, const char* p_end, uint64_t& value) noexcept {
+        while (p_end - p_begin >= 8) {
+            uint64_t chars = load_8_chars(p_begin);
+            if (!is_8_decimal_digits(chars)) {
+                break;
+            }
+            value = value * 100000000u + parse_8_decimal_digits(chars);
+            p_begin += 8;
+        }
+
+        while (p_begin != p_end && is_digit(*p_begin)) {
+            value = value * 10 + static_cast<uint64_t>(*p_begin - '0');
+            ++p_begin;
+        }
+        return p_begin;
+    }
+
+    /// The maximum number of decimal digits which always fit in a 64-bit unsigned integer.
+    static constexpr std::size_t max_mantissa_digits = 19;
+
+    /// @brief Converts the magnitude and the sign of a decimal integer into an integer value.
+    /// @tparam IntegerType The type of integer values.
+    /// @param magnitude The absolute value of the integer.
+    /// @param is_negative Whether the integer is negative.
+    /// @param i The output integer value holder.
+    /// @return true if the integer fits in IntegerType, false otherwise.
+    template <typename IntegerType>
+    static bool convert_integer(uint64_t magnitude, bool is_negative, IntegerType& i) noexcept {
+        using limits_type = std::numeric_limits<IntegerType>;
+        const uint64_t max_value = static_cast<uint64_t>(limits_type::max());
+
+        if (!is_negative) {
+            if (magnitude > max_value) {
+                return false;
+            }
+            i = static_cast<IntegerType>(magnitude);
+            return true;
+        }
+
+        if (!limits_type::is_signed || magnitude > max_value + 1) {
+            return false;
+        }
+
+        if (magnitude == 0) {
+            i = 0;
+            return true;
+        }
+
+        // negate (magnitude - 1) first to avoid overflow with the minimum value.
+        i = static_cast<IntegerType>(IntegerType(0) - static_cast<IntegerType>(magnitude - 1) - IntegerType(1));
+        return true;
+    }
+
     /// @brief Detects a scalar value type from the contents (possibly an integer or a floating-point value).
     /// @param itr The iterator to the first element of the scalar.
     /// @param len The length of the scalar contents.
@@ -0,0 +1,811 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INPUT_TYPED_DECODER_HPP
+#define FK_YAML_DETAIL_INPUT_TYPED_DECODER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/input/block_scalar_header.hpp>
+#include <fkYAML/detail/input/lexical_analyzer.hpp>
+#include <fkYAML/detail/input/scalar_parser.hpp>
+#include <fkYAML/detail/input/tag_t.hpp>
+#include <fkYAML/detail/meta/detect.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/str_view.hpp>
+#include <fkYAML/detail/types/lexical_token_t.hpp>
+#include <fkYAML/exception.hpp>
+#include <fkYAML/node_type.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A type of the function which decodes a mapping value into a field of a user-defined type.
+/// @note The function is defined with the FK_YAML_DEFINE_TYPE macro and found via ADL.
+/// @tparam DecoderType A typed_decoder template instance type.
+/// @tparam T A user-defined type.
+template <typename DecoderType, typename T>
+using decode_field_function_t =
+    decltype(fk_yaml_decode_field(std::declval<DecoderType&>(), std::declval<str_view>(), std::declval<T&>()));
+
+/// @brief Type traits to check if T has fields which can be decoded by DecoderType.
+/// @tparam DecoderType A typed_decoder template instance type.
+/// @tparam T A target value type.
+template <typename DecoderType, typename T>
+struct has_decode_field : is_detected_exact<bool, decode_field_function_t, DecoderType, T> {};
+
+/// @brief A decoder which converts a YAML document directly into native data objects without building YAML nodes.
+/// @note This decoder never reports errors on its own. It just gives up decoding if the input has any error, uses
+/// features which are not supported here (directives, node properties, aliases or explicit keys) or doesn't fit the
+/// target type, so that the caller can deserialize the input into YAML nodes and convert them instead, which reports
+/// the error if any. Scalars are converted with the same scalar_parser as the deserializer, and thus, the resulting
+/// objects are identical to those converted from the YAML nodes.
+/// The supported target types are std::vector, std::map, the string type and arithmetic types of BasicNodeType, and
+/// user-defined types whose fields are registered with the FK_YAML_DEFINE_TYPE macro.
+/// @tparam BasicNodeType A basic_node template instance type to be used for scalar conversions.
+template <typename BasicNodeType>
+class typed_decoder {
+    static_assert(is_basic_node<BasicNodeType>::value, "typed_decoder only accepts basic_node<...>");
+
+    /** A type for the target basic_node. */
+    using basic_node_type = BasicNodeType;
+    /** A type for string node values. */
+    using string_type = typename basic_node_type::string_type;
+    /** A type for the scalar parser. */
+    using scalar_parser_type = scalar_parser<basic_node_type>;
+    /** A type for numeric values converted while scalar value types are detected. */
+    using scanned_number_type = typename scalar_parser_type::scanned_number_type;
+
+    /// @brief A placeholder for values which are parsed and discarded.
+    struct ignored_value {};
+
+    /// @brief A scalar token with its position.
+    struct scalar_token {
+        /// The lexical token for the scalar.
+        lexical_token token {};
+        /// The line where the scalar begins.
+        uint32_t line {0};
+        /// The indentation width of the scalar.
+        uint32_t indent {0};
+        /// The block scalar header. (only for block scalars)
+        block_scalar_header header {};
+    };
+
+    /// @brief Context information to decode a mapping value.
+    struct value_context {
+        /// The indentation width of the mapping keys. (only for block mappings)
+        uint32_t indent {0};
+        /// The line of the key separator. (only for block mappings)
+        uint32_t line {0};
+        /// Whether the mapping is a flow mapping.
+        bool is_flow {false};
+    };
+
+public:
+    /// @brief Decode the first YAML document in the input into the value.
+    /// @tparam T The target value type.
+    /// @param input The input buffer.
+    /// @param value The storage for the resulting value. Its contents are unspecified if this function fails.
+    /// @return true if the document is decoded successfully, false otherwise.
+    template <typename T>
+    bool decode(str_view input, T& value) {
+        lexical_analyzer lexer(input);
+        mp_lexer = &lexer;
+        m_input = input;
+        m_flow_depth = 0;
+        m_num_decoded_fields = 0;
+        m_keys.clear();
+
+        bool is_decoded = false;
+        try {
+            is_decoded = decode_document(value);
+        }
+        catch (const exception& /*unused*/) {
+            // leave error reporting to the deserializer.
+            is_decoded = false;
+        }
+
+        mp_lexer = nullptr;
+        return is_decoded;
+    }
+
+    /// @brief Decode the current mapping value into a field of a user-defined type.
+    /// @note This function is called from the functions generated with the FK_YAML_DEFINE_TYPE macro.
+    /// @tparam FieldType The type of the field.
+    /// @param field The field to be assigned.
+    /// @return true if the value is decoded successfully, false otherwise.
+    template <typename FieldType>
+    bool decode_field(FieldType& field) {
+        ++m_num_decoded_fields;
+        return decode_mapping_value(field);
+    }
+
+    /// @brief Skip the current mapping value which is associated with no field of a user-defined type.
+    /// @note This function is called from the functions generated with the FK_YAML_DEFINE_TYPE macro.
+    /// @return true if the value is skipped successfully, false otherwise.
+    bool skip_field() {
+        ignored_value ignored {};
+        return decode_mapping_value(ignored);
+    }
+
+private:
+    /// @brief Decode a YAML document into the value.
+    /// @tparam T The target value type.
+    /// @param value The storage for the resulting value.
+    /// @return true if the document is decoded successfully, false otherwise.
+    template <typename T>
+    bool decode_document(T& value) {
+        mp_lexer->set_document_state(true);
+        next_token();
+
+        bool has_marker = m_token.type == lexical_token_t::END_OF_DIRECTIVES;
+        uint32_t marker_line = m_line;
+        if (has_marker) {
+            next_token();
+        }
+        mp_lexer->set_document_state(false);
+
+        switch (m_token.type) {
+        case lexical_token_t::YAML_VER_DIRECTIVE:
+        case lexical_token_t::TAG_DIRECTIVE:
+        case lexical_token_t::INVALID_DIRECTIVE:
+            return false;
+        default:
+            break;
+        }
+
+        if (is_end_token()) {
+            // an empty document.
+            return false;
+        }
+
+        // a block collection must not begin on the same line as the end of directives marker.
+        bool allows_block = !has_marker || m_line > marker_line;
+        return decode_value(value, allows_block) && is_end_token();
+    }
+
+    ////////////////////////
+    //   value decoders   //
+    ////////////////////////
+
+    /// @brief Decode the current node into a std::vector object.
+    /// @param seq The storage for the resulting sequence.
+    /// @param allows_block Whether a block collection is allowed here.
+    /// @return true if the node is decoded successfully, false otherwise.
+    template <typename ValueType, typename Allocator>
+    bool decode_value(std::vector<ValueType, Allocator>& seq, bool allows_block) {
+        seq.clear();
+        return decode_sequence(seq, allows_block);
+    }
+
+    /// @brief Decode the current node into a std::map object.
+    /// @param map The storage for the resulting mapping.
+    /// @param allows_block Whether a block collection is allowed here.
+    /// @return true if the node is decoded successfully, false otherwise.
+    template <typename KeyType, typename ValueType, typename Compare, typename Allocator>
+    bool decode_value(std::map<KeyType, ValueType, Compare, Allocator>& map, bool allows_block) {
+        map.clear();
+        return decode_mapping(map, allows_block);
+    }
+
+    /// @brief Decode the current node into a user-defined type object with registered fields.
+    /// @param value The storage for the resulting object.
+    /// @param allows_block Whether a block collection is allowed here.
+    /// @return true if the node is decoded successfully, false otherwise.
+    template <typename T, enable_if_t<has_decode_field<typed_decoder, T>::value, int> = 0>
+    bool decode_value(T& value, bool allows_block) {
+        std::size_t num_outer_fields = m_num_decoded_fields;
+        m_num_decoded_fields = 0;
+        // every field must be assigned. otherwise, the conversion from a YAML node would fail.
+        bool is_decoded = decode_mapping(value, allows_block) && m_num_decoded_fields == fk_yaml_count_fields(value);
+        m_num_decoded_fields = num_outer_fields;
+        return is_decoded;
+    }
+
+    /// @brief Decode the current node into a scalar value.
+    /// @param value The storage for the resulting value.
+    /// @return true if the node is decoded successfully, false otherwise.
+    template <
+        typename T,
+        enable_if_t<disjunction<std::is_same<T, string_type>, std::is_arithmetic<T>>::value, int> = 0>
+    bool decode_value(T& value, bool /*unused*/) {
+        if (!is_scalar_token()) {
+            return false;
+        }
+        scalar_token scalar = take_scalar();
+        return convert_scalar(scalar, value) && is_valid_after_scalar(scalar);
+    }
+
+    /// @brief Decode the current node of any kind and discard it.
+    /// @param allows_block Whether a block collection is allowed here.
+    /// @return true if the node is decoded successfully, false otherwise.
+    bool decode_value(ignored_value& ignored, bool allows_block) {
+        switch (m_token.type) {
+        case lexical_token_t::SEQUENCE_BLOCK_PREFIX:
+        case lexical_token_t::SEQUENCE_FLOW_BEGIN:
+            return decode_sequence(ignored, allows_block);
+        case lexical_token_t::MAPPING_FLOW_BEGIN:
+            return decode_flow_mapping(ignored);
+        case lexical_token_t::PLAIN_SCALAR:
+        case lexical_token_t::SINGLE_QUOTED_SCALAR:
+        case lexical_token_t::DOUBLE_QUOTED_SCALAR:
+        case lexical_token_t::BLOCK_LITERAL_SCALAR:
+        case lexical_token_t::BLOCK_FOLDED_SCALAR: {
+            scalar_token scalar = take_scalar();
+            if (allows_block && is_key_separator_of(scalar)) {
+                return decode_block_mapping(ignored, scalar);
+            }
+            // parse the scalar anyway to detect errors in it.
+            scalar_parser_type parser(scalar.line, scalar.indent);
+            scanned_number_type number {};
+            parse_scalar_contents(parser, scalar, number);
+            return is_valid_after_scalar(scalar);
+        }
+        default:
+            return false;
+        }
+    }
+
+    /// @brief Give up decoding the current node into an unsupported type.
+    /// @return false always.
+    template <
+        typename T,
+        enable_if_t<
+            negation<disjunction<
+                has_decode_field<typed_decoder, T>, std::is_same<T, string_type>, std::is_arithmetic<T>>>::value,
+            int> = 0>
+    bool decode_value(T& /*unused*/, bool /*unused*/) {
+        return false;
+    }
+
+    /// @brief Decode an empty node into the value.
+    /// @note Only ignored values accept empty nodes since the others cannot be converted from null nodes.
+    /// @return true for ignored values, false otherwise.
+    template <typename T>
+    static bool decode_null(T& /*unused*/) noexcept {
+        return false;
+    }
+
+    /// @brief Decode an empty node into an ignored value.
+    /// @return true always.
+    static bool decode_null(ignored_value& /*unused*/) noexcept {
+        return true;
+    }
+
+    ///////////////////////////
+    //   sequence decoders   //
+    ///////////////////////////
+
+    /// @brief Decode the current node as a sequence.
+    /// @tparam SeqType The type of the target sequence.
+    /// @param seq The storage for the resulting sequence.
+    /// @param allows_block Whether a block sequence is allowed here.
+    /// @return true if the node is decoded successfully, false otherwise.
+    template <typename SeqType>
+    bool decode_sequence(SeqType& seq, bool allows_block) {
+        switch (m_token.type) {
+        case lexical_token_t::SEQUENCE_FLOW_BEGIN:
+            return decode_flow_sequence(seq);
+        case lexical_token_t::SEQUENCE_BLOCK_PREFIX:
+            return allows_block && decode_block_sequence(seq);
+        default:
+            return false;
+        }
+    }
+
+    /// @brief Decode a block sequence which begins with the current token.
+    /// @tparam SeqType The type of the target sequence.
+    /// @param seq The storage for the resulting sequence.
+    /// @return true if the block sequence is decoded successfully, false otherwise.
+    template <typename SeqType>
+    bool decode_block_sequence(SeqType& seq) {
+        uint32_t indent = m_indent;
+        for (;;) {
+            // the current token is a block sequence entry prefix at the indentation.
+            uint32_t prefix_line = m_line;
+            next_token();
+
+            bool has_entry = !is_end_token() && (m_line == prefix_line || m_indent > indent);
+            if (has_entry) {
+                if (!decode_sequence_entry(seq, true)) {
+                    return false;
+                }
+            }
+            else if (!decode_null(seq)) {
+                return false;
+            }
+
+            if (is_end_token() || m_indent < indent) {
+                return true;
+            }
+            if (m_indent > indent) {
+                return false;
+            }
+            if (m_token.type != lexical_token_t::SEQUENCE_BLOCK_PREFIX) {
+                // a block mapping at the same indentation may continue.
+                return true;
+            }
+        }
+    }
+
+    /// @brief Decode a flow sequence which begins with the current token.
+    /// @tparam SeqType The type of the target sequence.
+    /// @param seq The storage for the resulting sequence.
+    /// @return true if the flow sequence is decoded successfully, false otherwise.
+    template <typename SeqType>
+    bool decode_flow_sequence(SeqType& seq) {
+        enter_flow();
+        if (m_token.type != lexical_token_t::SEQUENCE_FLOW_END) {
+            for (;;) {
+                if (!decode_sequence_entry(seq, false)) {
+                    return false;
+                }
+
+                if (m_token.type == lexical_token_t::VALUE_SEPARATOR) {
+                    next_token();
+                    if (m_token.type == lexical_token_t::SEQUENCE_FLOW_END) {
+                        break;
+                    }
+                    continue;
+                }
+                if (m_token.type == lexical_token_t::SEQUENCE_FLOW_END) {
+                    break;
+                }
+                return false;
+            }
+        }
+        return exit_flow();
+    }
+
+    /// @brief Decode the current node into a new std::vector element.
+    /// @param seq The target sequence.
+    /// @param allows_block Whether a block collection is allowed here.
+    /// @return true if the node is decoded successfully, false otherwise.
+    template <typename ValueType, typename Allocator>
+    bool decode_sequence_entry(std::vector<ValueType, Allocator>& seq, bool allows_block) {
+        ValueType value {};
+        if (!decode_value(value, allows_block)) {
+            return false;
+        }
+        seq.push_back(std::move(value));
+        return true;
+    }
+
+    /// @brief Decode the current node as an ignored sequence entry.
+    /// @param allows_block Whether a block collection is allowed here.
+    /// @return true if the node is decoded successfully, false otherwise.
+    bool decode_sequence_entry(ignored_value& /*unused*/, bool allows_block) {
+        ignored_value value {};
+        return decode_value(value, allows_block);
+    }
+
+    //////////////////////////
+    //   mapping decoders   //
+    //////////////////////////
+
+    /// @brief Decode the current node as a mapping.
+    /// @tparam MapType The type of the target mapping.
+    /// @param map The storage for the resulting mapping.
+    /// @param allows_block Whether a block mapping is allowed here.
+    /// @return true if the node is decoded successfully, false otherwise.
+    template <typename MapType>
+    bool decode_mapping(MapType& map, bool allows_block) {
+        if (m_token.type == lexical_token_t::MAPPING_FLOW_BEGIN) {
+            return decode_flow_mapping(map);
+        }
+        if (!allows_block || !is_flow_scalar_token()) {
+            return false;
+        }
+
+        scalar_token key = take_scalar();
+        return is_key_separator_of(key) && decode_block_mapping(map, key);
+    }
+
+    /// @brief Decode a block mapping whose first key has already been read.
+    /// @tparam MapType The type of the target mapping.
+    /// @param map The storage for the resulting mapping.
+    /// @param first_key The first key of the block mapping. The current token must be the key separator after it.
+    /// @return true if the block mapping is decoded successfully, false otherwise.
+    template <typename MapType>
+    bool decode_block_mapping(MapType& map, const scalar_token& first_key) {
+        uint32_t indent = first_key.indent;
+        std::size_t first_key_pos = m_keys.size();
+        scalar_token key = first_key;
+        for (;;) {
+            // the current token is the key separator after the key.
+            value_context context {};
+            context.indent = indent;
+            context.line = m_line;
+            next_token();
+
+            m_value_context = context;
+            if (!decode_mapping_entry(map, key)) {
+                return false;
+            }
+
+            if (is_end_token() || m_indent < indent) {
+                break;
+            }
+            if (m_indent > indent || !is_flow_scalar_token()) {
+                return false;
+            }
+            key = take_scalar();
+            if (!is_key_separator_of(key)) {
+                return false;
+            }
+        }
+        return has_unique_keys(first_key_pos);
+    }
+
+    /// @brief Decode a flow mapping which begins with the current token.
+    /// @tparam MapType The type of the target mapping.
+    /// @param map The storage for the resulting mapping.
+    /// @return true if the flow mapping is decoded successfully, false otherwise.
+    template <typename MapType>
+    bool decode_flow_mapping(MapType& map) {
+        std::size_t first_key_pos = m_keys.size();
+        enter_flow();
+        if (m_token.type != lexical_token_t::MAPPING_FLOW_END) {
+            for (;;) {
+                if (!is_flow_scalar_token()) {
+                    return false;
+                }
+                scalar_token key = take_scalar();
+                if (m_token.type != lexical_token_t::KEY_SEPARATOR || is_multiline(key)) {
+                    return false;
+                }
+                next_token();
+
+                m_value_context = value_context {};
+                m_value_context.is_flow = true;
+                if (!decode_mapping_entry(map, key)) {
+                    return false;
+                }
+
+                if (m_token.type == lexical_token_t::VALUE_SEPARATOR) {
+                    next_token();
+                    if (m_token.type == lexical_token_t::MAPPING_FLOW_END) {
+                        break;
+                    }
+                    continue;
+                }
+                if (m_token.type == lexical_token_t::MAPPING_FLOW_END) {
+                    break;
+                }
+                return false;
+            }
+        }
+        return exit_flow() && has_unique_keys(first_key_pos);
+    }
+
+    /// @brief Decode the current mapping value into a new std::map entry.
+    /// @param map The target mapping.
+    /// @param key The key of the entry.
+    /// @return true if the entry is decoded successfully, false otherwise.
+    template <typename KeyType, typename ValueType, typename Compare, typename Allocator>
+    bool decode_mapping_entry(std::map<KeyType, ValueType, Compare, Allocator>& map, const scalar_token& key) {
+        KeyType key_value {};
+        if (!convert_scalar(key, key_value)) {
+            return false;
+        }
+        ValueType value {};
+        if (!decode_mapping_value(value)) {
+            return false;
+        }
+        // duplicate keys are detected by the deserializer.
+        return map.emplace(std::move(key_value), std::move(value)).second;
+    }
+
+    /// @brief Decode the current mapping value into the field associated with the key.
+    /// @param value The target object.
+    /// @param key The key of the entry.
+    /// @return true if the entry is decoded successfully, false otherwise.
+    template <typename T, enable_if_t<has_decode_field<typed_decoder, T>::value, int> = 0>
+    bool decode_mapping_entry(T& value, const scalar_token& key) {
+        str_view key_str {};
+        if (!get_plain_key(key, key_str)) {
+            return false;
+        }
+        m_keys.push_back(key_str);
+        return fk_yaml_decode_field(*this, key_str, value);
+    }
+
+    /// @brief Decode the current mapping value as an ignored value.
+    /// @param key The key of the entry.
+    /// @return true if the entry is decoded successfully, false otherwise.
+    bool decode_mapping_entry(ignored_value& /*unused*/, const scalar_token& key) {
+        str_view key_str {};
+        if (!get_plain_key(key, key_str)) {
+            return false;
+        }
+        m_keys.push_back(key_str);
+        return skip_field();
+    }
+
+    /// @brief Decode the current mapping value into the value.
+    /// @tparam T The target value type.
+    /// @param value The storage for the resulting value.
+    /// @return true if the mapping value is decoded successfully, false otherwise.
+    template <typename T>
+    bool decode_mapping_value(T& value) {
+        value_context context = m_value_context;
+        if (context.is_flow) {
+            bool is_empty =
+                m_token.type == lexical_token_t::VALUE_SEPARATOR || m_token.type == lexical_token_t::MAPPING_FLOW_END;
+            return is_empty ? decode_null(value) : decode_value(value, false);
+        }
+
+        if (is_end_token()) {
+            return decode_null(value);
+        }
+        if (m_line == context.line) {
+            // a block collection must not begin on the same line as the key.
+            return decode_value(value, false);
+        }
+        bool is_compact_seq = m_indent == context.indent && m_token.type == lexical_token_t::SEQUENCE_BLOCK_PREFIX;
+        if (m_indent > context.indent || is_compact_seq) {
+            return decode_value(value, true);
+        }
+        return decode_null(value);
+    }
+
+    /// @brief Check if keys in a mapping are unique.
+    /// @param first_key_pos The position of the first key of the mapping in the key stack.
+    /// @return true if the keys are unique, false otherwise.
+    bool has_unique_keys(std::size_t first_key_pos) {
+        auto first = m_keys.begin() + static_cast<std::ptrdiff_t>(first_key_pos);
+        std::sort(first, m_keys.end());
+        bool is_unique = std::adjacent_find(first, m_keys.end()) == m_keys.end();
+        m_keys.erase(first, m_keys.end());
+        return is_unique;
+    }
+
+    //////////////////////////
+    //   scalar utilities   //
+    //////////////////////////
+
+    /// @brief Convert a scalar into a string.
+    /// @param scalar A scalar token.
+    /// @param str The storage for the resulting string.
+    /// @return true if the scalar is a string, false otherwise.
+    bool convert_scalar(const scalar_token& scalar, string_type& str) {
+        scalar_parser_type parser(scalar.line, scalar.indent);
+        scanned_number_type number {};
+        str_view contents = scalar.token.str;
+        if (parse_scalar_contents(parser, scalar, contents, number) != node_type::STRING) {
+            return false;
+        }
+        str.assign(contents.begin(), contents.end());
+        return true;
+    }
+
+    /// @brief Convert a scalar into an arithmetic value.
+    /// @param scalar A scalar token.
+    /// @param value The storage for the resulting value.
+    /// @return true if the scalar is converted successfully, false otherwise.
+    template <typename T, enable_if_t<std::is_arithmetic<T>::value, int> = 0>
+    bool convert_scalar(const scalar_token& scalar, T& value) {
+        // the same conversion as the one from a YAML node. no allocation happens for non-string scalars.
+        scalar_parser_type parser(scalar.line, scalar.indent);
+        basic_node_type node =
+            is_block_scalar(scalar.token.type)
+                ? parser.parse_block(scalar.token.type, tag_t::NONE, scalar.token.str, scalar.header)
+                : parser.parse_flow(scalar.token.type, tag_t::NONE, scalar.token.str);
+        value = node.template get_value<T>();
+        return true;
+    }
+
+    /// @brief Give up converting a scalar into an unsupported type.
+    /// @return false always.
+    template <
+        typename T,
+        enable_if_t<negation<disjunction<std::is_same<T, string_type>, std::is_arithmetic<T>>>::value, int> = 0>
+    bool convert_scalar(const scalar_token& /*unused*/, T& /*unused*/) {
+        return false;
+    }
+
+    /// @brief Parse a scalar into its contents and detect its value type.
+    /// @param parser A scalar parser which may hold the resulting contents.
+    /// @param scalar A scalar token.
+    /// @param contents The storage for the resulting contents.
+    /// @param number The storage for the numeric value converted on the way if any.
+    /// @return node_type The value type of the scalar.
+    static node_type parse_scalar_contents(
+        scalar_parser_type& parser, const scalar_token& scalar, str_view& contents, scanned_number_type& number) {
+        contents = scalar.token.str;
+        if (is_block_scalar(scalar.token.type)) {
+            return parser.parse_block_contents(scalar.token.type, tag_t::NONE, contents, scalar.header, number);
+        }
+        return parser.parse_flow_contents(scalar.token.type, tag_t::NONE, contents, number);
+    }
+
+    /// @brief Parse a scalar into its contents and detect its value type.
+    /// @param parser A scalar parser which may hold the resulting contents.
+    /// @param scalar A scalar token.
+    /// @param number The storage for the numeric value converted on the way if any.
+    /// @return node_type The value type of the scalar.
+    static node_type parse_scalar_contents(
+        scalar_parser_type& parser, const scalar_token& scalar, scanned_number_type& number) {
+        str_view contents {};
+        return parse_scalar_contents(parser, scalar, contents, number);
+    }
+
+    /// @brief Get the contents of a mapping key which is a string written as is in the input buffer.
+    /// @note Keys are compared in the input buffer to detect duplicates without copying them. Other keys, e.g.,
+    /// escaped ones, are not supported.
+    /// @param key A key scalar token.
+    /// @param key_str The storage for the resulting key contents.
+    /// @return true if the key is a supported string, false otherwise.
+    bool get_plain_key(const scalar_token& key, str_view& key_str) const {
+        scalar_parser_type parser(key.line, key.indent);
+        scanned_number_type number {};
+        if (parse_scalar_contents(parser, key, key_str, number) != node_type::STRING) {
+            return false;
+        }
+        if (key_str.empty()) {
+            key_str = str_view {};
+            return true;
+        }
+
+        std::less_equal<const char*> less_equal {};
+        return less_equal(m_input.begin(), key_str.begin()) && less_equal(key_str.end(), m_input.end());
+    }
+
+    /// @brief Take the current scalar token and move on to the next token.
+    /// @return scalar_token The scalar token.
+    scalar_token take_scalar() {
+        scalar_token scalar {};
+        scalar.token = m_token;
+        scalar.line = m_line;
+        scalar.indent = m_indent;
+        if (is_block_scalar(m_token.type)) {
+            scalar.header = mp_lexer->get_block_scalar_header();
+        }
+        next_token();
+        return scalar;
+    }
+
+    /// @brief Check if the current token is a key separator for the given scalar as an implicit key.
+    /// @param scalar A scalar token just before the current token.
+    /// @return true if the current token is a key separator for the scalar, false otherwise.
+    bool is_key_separator_of(const scalar_token& scalar) const noexcept {
+        return m_token.type == lexical_token_t::KEY_SEPARATOR && m_line == scalar.line &&
+               !is_block_scalar(scalar.token.type) && !is_multiline(scalar);
+    }
+
+    /// @brief Check if the current token can follow the given scalar as a value.
+    /// @param scalar A scalar token just before the current token.
+    /// @return true if the current token can follow the scalar, false otherwise.
+    bool is_valid_after_scalar(const scalar_token& scalar) const noexcept {
+        if (m_flow_depth > 0) {
+            switch (m_token.type) {
+            case lexical_token_t::VALUE_SEPARATOR:
+            case lexical_token_t::SEQUENCE_FLOW_END:
+            case lexical_token_t::MAPPING_FLOW_END:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        uint32_t last_line = scalar.line;
+        if (!is_block_scalar(scalar.token.type)) {
+            str_view str = scalar.token.str;
+            last_line += static_cast<uint32_t>(std::count(str.begin(), str.end(), '\n'));
+        }
+        return is_end_token() || m_line > last_line;
+    }
+
+    /// @brief Check if a scalar spans multiple lines.
+    /// @param scalar A scalar token.
+    /// @return true if the scalar spans multiple lines, false otherwise.
+    static bool is_multiline(const scalar_token& scalar) noexcept {
+        return scalar.token.str.find('\n') != str_view::npos;
+    }
+
+    /// @brief Check if the lexical token type is a block scalar.
+    /// @param type A lexical token type.
+    /// @return true if the type is a block scalar, false otherwise.
+    static bool is_block_scalar(lexical_token_t type) noexcept {
+        return type == lexical_token_t::BLOCK_LITERAL_SCALAR || type == lexical_token_t::BLOCK_FOLDED_SCALAR;
+    }
+
+    /////////////////////////
+    //   token utilities   //
+    /////////////////////////
+
+    /// @brief Move on to the next token.
+    void next_token() {
+        m_token = mp_lexer->get_next_token();
+        m_line = mp_lexer->get_lines_processed();
+        m_indent = mp_lexer->get_last_token_begin_pos();
+    }
+
+    /// @brief Move on to the first token in a flow collection.
+    void enter_flow() {
+        if (m_flow_depth++ == 0) {
+            mp_lexer->set_context_state(true);
+        }
+        next_token();
+    }
+
+    /// @brief Move on to the token after a flow collection.
+    /// @return true if the token can follow the flow collection, false otherwise.
+    bool exit_flow() {
+        uint32_t end_line = m_line;
+        if (--m_flow_depth == 0) {
+            mp_lexer->set_context_state(false);
+        }
+        next_token();
+        // the next node in the block context must begin on a later line.
+        return m_flow_depth > 0 || is_end_token() || m_line > end_line;
+    }
+
+    /// @brief Check if the current token ends the document.
+    /// @return true if the current token ends the document, false otherwise.
+    bool is_end_token() const noexcept {
+        switch (m_token.type) {
+        case lexical_token_t::END_OF_BUFFER:
+        case lexical_token_t::END_OF_DIRECTIVES:
+        case lexical_token_t::END_OF_DOCUMENT:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /// @brief Check if the current token is a scalar.
+    /// @return true if the current token is a scalar, false otherwise.
+    bool is_scalar_token() const noexcept {
+        return is_flow_scalar_token() || is_block_scalar(m_token.type);
+    }
+
+    /// @brief Check if the current token is a flow scalar.
+    /// @return true if the current token is a flow scalar, false otherwise.
+    bool is_flow_scalar_token() const noexcept {
+        switch (m_token.type) {
+        case lexical_token_t::PLAIN_SCALAR:
+        case lexical_token_t::SINGLE_QUOTED_SCALAR:
+        case lexical_token_t::DOUBLE_QUOTED_SCALAR:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+private:
+    /// The lexical analyzer for the current input.
+    lexical_analyzer* mp_lexer {nullptr};
+    /// The current input buffer.
+    str_view m_input {};
+    /// The current lexical token.
+    lexical_token m_token {};
+    /// The line where the current token begins.
+    uint32_t m_line {0};
+    /// The indentation width of the current token.
+    uint32_t m_indent {0};
+    /// The depth of the current flow collections.
+    uint32_t m_flow_depth {0};
+    /// The context of the mapping value to be decoded next.
+    value_context m_value_context {};
+    /// The number of fields decoded in the current user-defined type object.
+    std::size_t m_num_decoded_fields {0};
+    /// The keys of the mappings being decoded, which are used to detect duplicate keys.
+    std::vector<str_view> m_keys {};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_INPUT_TYPED_DECODER_HPP */
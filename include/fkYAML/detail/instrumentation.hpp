@@ -0,0 +1,208 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_INSTRUMENTATION_HPP
+#define FK_YAML_DETAIL_INSTRUMENTATION_HPP
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/parse_stats.hpp>
+
+// The instrumentation hooks are compiled out unless FK_YAML_ENABLE_INSTRUMENTATION is defined.
+// Note that the macro must be defined (or not) consistently in all the translation units of a program.
+#ifdef FK_YAML_ENABLE_INSTRUMENTATION
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A recorder of statistics of the running deserialization on the current thread.
+class parse_recorder {
+    /** A type for the clock to measure durations of parse phases. */
+    using clock_type = std::chrono::steady_clock;
+
+public:
+    /// @brief Get the recorder of the current thread.
+    /// @return parse_recorder*& The reference to the pointer to the current recorder. (null if not recording)
+    static parse_recorder*& current() noexcept {
+        static thread_local parse_recorder* p_current = nullptr;
+        return p_current;
+    }
+
+    /// @brief Get the current parse phase.
+    /// @return parse_phase The current parse phase.
+    parse_phase phase() const noexcept {
+        return m_phase;
+    }
+
+    /// @brief Switch the current parse phase. The time since the last switch is added to the previous phase.
+    /// @param phase A new parse phase.
+    void switch_phase(parse_phase phase) noexcept {
+        clock_type::time_point now = clock_type::now();
+        m_stats.durations[static_cast<std::size_t>(m_phase)] +=
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_phase_begin);
+        m_phase = phase;
+        m_phase_begin = now;
+    }
+
+    /// @brief Restart measuring the current phase without adding the time since the last switch.
+    void discard_elapsed() noexcept {
+        m_phase_begin = clock_type::now();
+    }
+
+    /// @brief Get the recorded statistics.
+    /// @return parse_stats& The recorded statistics.
+    parse_stats& stats() noexcept {
+        return m_stats;
+    }
+
+private:
+    /// The recorded statistics.
+    parse_stats m_stats {};
+    /// The current parse phase.
+    parse_phase m_phase {parse_phase::TREE_BUILDING};
+    /// The time when the current parse phase began.
+    clock_type::time_point m_phase_begin {clock_type::now()};
+};
+
+/// @brief A scope of a deserialization whose statistics are reported to the callback at its end.
+/// @note Nested sessions, e.g., public deserialization APIs called by others, are merged into the outermost one.
+class parse_session {
+public:
+    /// @brief Start recording statistics if a callback is set and no other session is running on the thread.
+    parse_session() noexcept {
+        if (parse_recorder::current() == nullptr && parse_stats_callback_storage()) {
+            parse_recorder::current() = &m_recorder;
+            m_is_active = true;
+        }
+    }
+
+    parse_session(const parse_session&) = delete;
+    parse_session& operator=(const parse_session&) = delete;
+
+    /// @brief Finish recording statistics and report them to the callback.
+    ~parse_session() {
+        if (m_is_active) {
+            m_recorder.switch_phase(m_recorder.phase());
+            parse_recorder::current() = nullptr;
+            parse_stats_callback_storage()(m_recorder.stats());
+        }
+    }
+
+private:
+    /// The recorder of this session.
+    parse_recorder m_recorder {};
+    /// Whether this session records statistics.
+    bool m_is_active {false};
+};
+
+/// @brief A scope in which the time is attributed to the given parse phase.
+class phase_scope {
+public:
+    /// @brief Switch to the given phase if statistics are being recorded.
+    /// @param phase A parse phase.
+    explicit phase_scope(parse_phase phase) noexcept
+        : mp_recorder(parse_recorder::current()) {
+        if (mp_recorder) {
+            m_prev_phase = mp_recorder->phase();
+            mp_recorder->switch_phase(phase);
+        }
+    }
+
+    phase_scope(const phase_scope&) = delete;
+    phase_scope& operator=(const phase_scope&) = delete;
+
+    /// @brief Switch back to the previous phase.
+    ~phase_scope() {
+        if (mp_recorder) {
+            mp_recorder->switch_phase(m_prev_phase);
+        }
+    }
+
+private:
+    /// The recorder of the running session. (null if not recording)
+    parse_recorder* mp_recorder {nullptr};
+    /// The phase before this scope.
+    parse_phase m_prev_phase {parse_phase::TREE_BUILDING};
+};
+
+/// @brief Add the given amount to a counter of the running session if any.
+/// @param p_counter A pointer to the counter member of parse_stats.
+/// @param amount The amount to be added.
+inline void add_parse_count(uint64_t parse_stats::*p_counter, uint64_t amount) noexcept {
+    parse_recorder* p_recorder = parse_recorder::current();
+    if (p_recorder) {
+        p_recorder->stats().*p_counter += amount;
+    }
+}
+
+/// @brief Count the given node and its descendants by type.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @param node A node to be counted.
+/// @param stats The statistics to record the counts.
+template <typename BasicNodeType>
+inline void count_nodes_impl(const BasicNodeType& node, parse_stats& stats) {
+    node_type type = node.get_type();
+    ++stats.num_nodes[static_cast<std::size_t>(type)];
+
+    switch (type) {
+    case node_type::SEQUENCE:
+        for (const auto& elem : node.template get_value_ref<const typename BasicNodeType::sequence_type&>()) {
+            count_nodes_impl(elem, stats);
+        }
+        break;
+    case node_type::MAPPING:
+        for (const auto& pair : node.template get_value_ref<const typename BasicNodeType::mapping_type&>()) {
+            count_nodes_impl(pair.first, stats);
+            count_nodes_impl(pair.second, stats);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/// @brief Count the resulting nodes of the running session if any. The time spent here is not recorded.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @param node A resulting root node.
+template <typename BasicNodeType>
+inline void count_parse_nodes(const BasicNodeType& node) {
+    parse_recorder* p_recorder = parse_recorder::current();
+    if (p_recorder) {
+        p_recorder->switch_phase(p_recorder->phase());
+        count_nodes_impl(node, p_recorder->stats());
+        p_recorder->discard_elapsed();
+    }
+}
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+/// @brief Record statistics of deserialization in the enclosing scope.
+#define FK_YAML_INSTRUMENT_SESSION() ::fkyaml::detail::parse_session fk_yaml_parse_session {}
+
+/// @brief Attribute the time in the enclosing scope to the given parse phase.
+#define FK_YAML_INSTRUMENT_PHASE(phase) ::fkyaml::detail::phase_scope fk_yaml_phase_scope(::fkyaml::parse_phase::phase)
+
+/// @brief Add the given amount to the given counter of parse_stats.
+#define FK_YAML_INSTRUMENT_COUNT(counter, amount)                                                                      \
+    ::fkyaml::detail::add_parse_count(&::fkyaml::parse_stats::counter, static_cast<uint64_t>(amount))
+
+/// @brief Count the given resulting node and its descendants by type.
+#define FK_YAML_INSTRUMENT_NODES(node) ::fkyaml::detail::count_parse_nodes(node)
+
+#else
+
+#define FK_YAML_INSTRUMENT_SESSION() static_cast<void>(0)
+#define FK_YAML_INSTRUMENT_PHASE(phase) static_cast<void>(0)
+#define FK_YAML_INSTRUMENT_COUNT(counter, amount) static_cast<void>(0)
+#define FK_YAML_INSTRUMENT_NODES(node) static_cast<void>(0)
+
+#endif
+
+#endif /* FK_YAML_DETAIL_INSTRUMENTATION_HPP */
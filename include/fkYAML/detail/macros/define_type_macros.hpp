@@ -0,0 +1,155 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_MACROS_DEFINE_TYPE_MACROS_HPP
+#define FK_YAML_DETAIL_MACROS_DEFINE_TYPE_MACROS_HPP
+
+#include <cstddef>
+
+#include <fkYAML/detail/conversions/struct_binder.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/str_view.hpp>
+
+//////////////////////////////
+//   preprocessor utilities
+//////////////////////////////
+
+// expands the given argument. (a workaround for the traditional preprocessor of MSVC)
+#define FK_YAML_PP_EXPAND(x) x
+
+// converts the given argument into a string literal.
+#define FK_YAML_PP_STRINGIZE(x) #x
+
+// selects the 33th argument.
+#define FK_YAML_PP_ARG_33(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20,   \
+    _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, name, ...) name
+
+// counts the given arguments. (up to 32 arguments)
+// the trailing dummy argument keeps `...` in FK_YAML_PP_ARG_33 from being empty, which is ill-formed before C++20.
+#define FK_YAML_PP_COUNT(...)                                                                                          \
+    FK_YAML_PP_EXPAND(FK_YAML_PP_ARG_33(                                                                               \
+        __VA_ARGS__, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, \
+        7, 6, 5, 4, 3, 2, 1, _))
+
+// applies `what` to each of the given arguments. (up to 32 arguments)
+#define FK_YAML_PP_FOR_EACH(what, ...)                                                                                 \
+    FK_YAML_PP_EXPAND(FK_YAML_PP_ARG_33(                                                                               \
+        __VA_ARGS__, FK_YAML_PP_FOR_EACH_32, FK_YAML_PP_FOR_EACH_31, FK_YAML_PP_FOR_EACH_30, FK_YAML_PP_FOR_EACH_29,   \
+        FK_YAML_PP_FOR_EACH_28, FK_YAML_PP_FOR_EACH_27, FK_YAML_PP_FOR_EACH_26, FK_YAML_PP_FOR_EACH_25,                \
+        FK_YAML_PP_FOR_EACH_24, FK_YAML_PP_FOR_EACH_23, FK_YAML_PP_FOR_EACH_22, FK_YAML_PP_FOR_EACH_21,                \
+        FK_YAML_PP_FOR_EACH_20, FK_YAML_PP_FOR_EACH_19, FK_YAML_PP_FOR_EACH_18, FK_YAML_PP_FOR_EACH_17,                \
+        FK_YAML_PP_FOR_EACH_16, FK_YAML_PP_FOR_EACH_15, FK_YAML_PP_FOR_EACH_14, FK_YAML_PP_FOR_EACH_13,                \
+        FK_YAML_PP_FOR_EACH_12, FK_YAML_PP_FOR_EACH_11, FK_YAML_PP_FOR_EACH_10, FK_YAML_PP_FOR_EACH_9,                 \
+        FK_YAML_PP_FOR_EACH_8, FK_YAML_PP_FOR_EACH_7, FK_YAML_PP_FOR_EACH_6, FK_YAML_PP_FOR_EACH_5,                    \
+        FK_YAML_PP_FOR_EACH_4, FK_YAML_PP_FOR_EACH_3, FK_YAML_PP_FOR_EACH_2, FK_YAML_PP_FOR_EACH_1,                    \
+        _)(what, __VA_ARGS__))
+
+#define FK_YAML_PP_FOR_EACH_1(what, x) what(x)
+#define FK_YAML_PP_FOR_EACH_2(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_1(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_3(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_2(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_4(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_3(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_5(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_4(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_6(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_5(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_7(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_6(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_8(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_7(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_9(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_8(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_10(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_9(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_11(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_10(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_12(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_11(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_13(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_12(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_14(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_13(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_15(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_14(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_16(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_15(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_17(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_16(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_18(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_17(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_19(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_18(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_20(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_19(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_21(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_20(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_22(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_21(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_23(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_22(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_24(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_23(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_25(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_24(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_26(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_25(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_27(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_26(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_28(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_27(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_29(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_28(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_30(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_29(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_31(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_30(what, __VA_ARGS__))
+#define FK_YAML_PP_FOR_EACH_32(what, x, ...) what(x) FK_YAML_PP_EXPAND(FK_YAML_PP_FOR_EACH_31(what, __VA_ARGS__))
+
+///////////////////////////
+//   FK_YAML_DEFINE_TYPE
+///////////////////////////
+
+// converts a mapping value into the field if the current key matches the field name.
+#define FK_YAML_DETAIL_BIND_FIELD(field)                                                                               \
+    if (fk_yaml_binder.bind(fk_yaml_key, FK_YAML_PP_STRINGIZE(field), fk_yaml_pair.second, fk_yaml_value.field)) {     \
+        continue;                                                                                                      \
+    }
+
+// throws an out_of_range exception if the mapping has no key for the field.
+#define FK_YAML_DETAIL_REQUIRE_FIELD(field) fk_yaml_binder.require(FK_YAML_PP_STRINGIZE(field));
+
+// stores the field into a mapping with the field name as its key.
+#define FK_YAML_DETAIL_STORE_FIELD(field)                                                                              \
+    fk_yaml_binder_type::store(fk_yaml_mapping, FK_YAML_PP_STRINGIZE(field), fk_yaml_value.field);
+
+// decodes the current mapping value directly into the field if the key matches the field name.
+#define FK_YAML_DETAIL_DECODE_FIELD(field)                                                                             \
+    if (::fkyaml::detail::is_field_name(fk_yaml_key, FK_YAML_PP_STRINGIZE(field))) {                                   \
+        return fk_yaml_decoder.decode_field(fk_yaml_value.field);                                                      \
+    }
+
+/// @brief Defines from_node and to_node functions for a struct/class with the given public fields.
+/// @note This macro must be used in the same namespace as the struct/class so that the functions can be found via ADL.
+/// The generated from_node function iterates the mapping only once and dispatches each key to the field with the same
+/// name. It throws a type_error if the node is not a mapping, and an out_of_range if any field has no key in it.
+/// Keys which match no field are ignored.
+/// The other generated functions let fkyaml::basic_node::deserialize_into decode the fields without building nodes.
+/// @sa https://fktn-k.github.io/fkYAML/api/macros/#struct-bindings
+#define FK_YAML_DEFINE_TYPE(type, ...)                                                                                 \
+    template <                                                                                                         \
+        typename BasicNodeType,                                                                                        \
+        ::fkyaml::detail::enable_if_t<::fkyaml::detail::is_basic_node<BasicNodeType>::value, int> = 0>                 \
+    inline void from_node(const BasicNodeType& fk_yaml_node, type& fk_yaml_value) {                                    \
+        ::fkyaml::detail::struct_binder<BasicNodeType> fk_yaml_binder(fk_yaml_node);                                   \
+        for (const auto& fk_yaml_pair : fk_yaml_binder.mapping()) {                                                    \
+            ::fkyaml::detail::str_view fk_yaml_key {};                                                                 \
+            if (!fk_yaml_binder.get_key(fk_yaml_pair.first, fk_yaml_key)) {                                            \
+                continue;                                                                                              \
+            }                                                                                                          \
+            FK_YAML_PP_FOR_EACH(FK_YAML_DETAIL_BIND_FIELD, __VA_ARGS__)                                                \
+        }                                                                                                              \
+        if (fk_yaml_binder.num_bound_fields() != FK_YAML_PP_COUNT(__VA_ARGS__)) {                                      \
+            FK_YAML_PP_FOR_EACH(FK_YAML_DETAIL_REQUIRE_FIELD, __VA_ARGS__)                                             \
+        }                                                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    template <                                                                                                         \
+        typename BasicNodeType,                                                                                        \
+        ::fkyaml::detail::enable_if_t<::fkyaml::detail::is_basic_node<BasicNodeType>::value, int> = 0>                 \
+    inline void to_node(BasicNodeType& fk_yaml_node, const type& fk_yaml_value) {                                      \
+        using fk_yaml_binder_type = ::fkyaml::detail::struct_binder<BasicNodeType>;                                    \
+        fk_yaml_node = BasicNodeType::mapping();                                                                       \
+        auto& fk_yaml_mapping = fk_yaml_node.template get_value_ref<typename BasicNodeType::mapping_type&>();          \
+        FK_YAML_PP_FOR_EACH(FK_YAML_DETAIL_STORE_FIELD, __VA_ARGS__)                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    template <typename FkYamlDecoder>                                                                                  \
+    inline bool fk_yaml_decode_field(                                                                                  \
+        FkYamlDecoder& fk_yaml_decoder, ::fkyaml::detail::str_view fk_yaml_key, type& fk_yaml_value) {                 \
+        FK_YAML_PP_FOR_EACH(FK_YAML_DETAIL_DECODE_FIELD, __VA_ARGS__)                                                  \
+        return fk_yaml_decoder.skip_field();                                                                           \
+    }                                                                                                                  \
+                                                                                                                       \
+    inline constexpr std::size_t fk_yaml_count_fields(const type& /*unused*/) noexcept {                               \
+        return FK_YAML_PP_COUNT(__VA_ARGS__);                                                                          \
+    }
+
+#endif /* FK_YAML_DETAIL_MACROS_DEFINE_TYPE_MACROS_HPP */
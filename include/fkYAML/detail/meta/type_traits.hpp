@@ -9,9 +9,11 @@
 #ifndef FK_YAML_DETAIL_META_TYPE_TRAITS_HPP
 #define FK_YAML_DETAIL_META_TYPE_TRAITS_HPP
 
+#include <cstddef>
 #include <iterator>
 #include <limits>
 #include <type_traits>
+#include <utility>
 
 #include <fkYAML/detail/macros/version_macros.hpp>
 #include <fkYAML/detail/meta/detect.hpp>
@@ -160,6 +162,26 @@ struct get_head_type<First, Rest...> {
 template <typename... Types>
 using head_type = typename get_head_type<Types...>::type;
 
+/// @brief A type which represents reserve function.
+/// @tparam ContainerType A target container type.
+template <typename ContainerType>
+using reserve_fn_t = decltype(std::declval<ContainerType&>().reserve(std::declval<std::size_t>()));
+
+/// @brief Type traits to check if ContainerType has reserve member function, e.g., std::vector.
+/// @tparam ContainerType A target container type.
+template <typename ContainerType>
+using has_reserve = is_detected<reserve_fn_t, ContainerType>;
+
+/// @brief A type which represents capacity function.
+/// @tparam ContainerType A target container type.
+template <typename ContainerType>
+using capacity_fn_t = decltype(std::declval<const ContainerType&>().capacity());
+
+/// @brief Type traits to check if ContainerType has capacity member function, e.g., std::vector.
+/// @tparam ContainerType A target container type.
+template <typename ContainerType>
+using has_capacity = is_detected<capacity_fn_t, ContainerType>;
+
 FK_YAML_DETAIL_NAMESPACE_END
 
 #endif /* FK_YAML_DETAIL_META_TYPE_TRAITS_HPP */
@@ -26,7 +26,9 @@ namespace node_attr_mask {
 /// The bit mask for node value type bits.
 const node_attr_t value = 0x0000FFFFu;
 /// The bit mask for node style type bits. (bits are not yet defined.)
-const node_attr_t style = 0x00FF0000u;
+const node_attr_t style = 0x000F0000u;
+/// The bit mask for node value storage type bits.
+const node_attr_t storage = 0x00F00000u;
 /// The bit mask for node property related bits.
 const node_attr_t props = 0xFF000000u;
 /// The bit mask for anchor/alias node type bits.
@@ -59,6 +61,9 @@ const node_attr_t string_bit = 1u << 6;
 /// A utility bit set to filter scalar node bits.
 const node_attr_t scalar_bits = null_bit | bool_bit | int_bit | float_bit | string_bit;
 
+/// The string value is borrowed from an external buffer instead of being owned by the node.
+const node_attr_t borrowed_str_bit = 0x00100000u;
+
 /// The anchor node bit.
 const node_attr_t anchor_bit = 0x01000000u;
 /// The alias node bit.
@@ -0,0 +1,192 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_NODE_MEMORY_COUNTER_HPP
+#define FK_YAML_DETAIL_NODE_MEMORY_COUNTER_HPP
+
+#include <cstddef>
+#include <set>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/document_metainfo.hpp>
+#include <fkYAML/detail/input/key_intern_table.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/meta/stl_supplement.hpp>
+#include <fkYAML/detail/meta/type_traits.hpp>
+#include <fkYAML/detail/node_attrs.hpp>
+#include <fkYAML/node_memory_usage.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A class which estimates the memory footprint of node trees by walking their internal representation.
+/// @tparam BasicNodeType A basic_node template instance type.
+template <typename BasicNodeType>
+class node_memory_counter {
+    static_assert(is_basic_node<BasicNodeType>::value, "node_memory_counter only accepts basic_node<...>");
+
+    /** A type for sequence node values. */
+    using sequence_type = typename BasicNodeType::sequence_type;
+    /** A type for mapping node values. */
+    using mapping_type = typename BasicNodeType::mapping_type;
+    /** A type for string node values. */
+    using string_type = typename BasicNodeType::string_type;
+    /** A type for document metainfo objects. */
+    using metainfo_type = document_metainfo<BasicNodeType>;
+
+public:
+    /// @brief Estimate the memory footprint of the given node tree.
+    /// @param node A root node.
+    /// @return node_memory_usage The estimated bytes by category.
+    node_memory_usage count(const BasicNodeType& node) {
+        m_usage = node_memory_usage();
+        m_counted_objects.clear();
+
+        m_usage.node_bytes += sizeof(BasicNodeType);
+        count_node(node, m_usage);
+        return m_usage;
+    }
+
+private:
+    /// @brief Count the heap-allocated data of the given node and its descendants.
+    /// @param node A node to be counted. The node object itself must be counted by the caller.
+    /// @param usage The report to which the bytes are added.
+    void count_node(const BasicNodeType& node, node_memory_usage& usage) {
+        count_metainfo(node.mp_meta.get());
+        usage.string_bytes += string_heap_bytes(node.m_prop.tag) + string_heap_bytes(node.m_prop.anchor);
+
+        // the values of anchor and alias nodes are stored in the anchor table.
+        // borrowed strings refer to either the input buffer or the key table held in the metainfo.
+        if (node.m_attrs & (node_attr_mask::anchoring | node_attr_bits::borrowed_str_bit)) {
+            return;
+        }
+
+        switch (node.m_attrs & node_attr_mask::value) {
+        case node_attr_bits::seq_bit: {
+            const sequence_type& seq = *node.m_node_value.p_sequence;
+            usage.container_bytes += sizeof(sequence_type);
+            usage.node_bytes += seq.size() * sizeof(BasicNodeType);
+            usage.slack_bytes += capacity_slack(seq);
+            for (const auto& elem : seq) {
+                count_node(elem, usage);
+            }
+            break;
+        }
+        case node_attr_bits::map_bit: {
+            const mapping_type& map = *node.m_node_value.p_mapping;
+            usage.container_bytes += sizeof(mapping_type);
+            usage.node_bytes += map.size() * sizeof(typename mapping_type::value_type);
+            usage.container_bytes += map.size() * element_overhead(map);
+            usage.slack_bytes += capacity_slack(map);
+            for (const auto& pair : map) {
+                count_node(pair.first, usage);
+                count_node(pair.second, usage);
+            }
+            break;
+        }
+        case node_attr_bits::string_bit:
+            usage.string_bytes += sizeof(string_type) + string_heap_bytes(*node.m_node_value.p_string);
+            break;
+        default:
+            break;
+        }
+    }
+
+    /// @brief Count the given document metainfo object if it has not been counted yet.
+    /// @param p_meta A pointer to a document metainfo object. (maybe null)
+    void count_metainfo(const metainfo_type* p_meta) {
+        if (!p_meta || !m_counted_objects.insert(p_meta).second) {
+            return;
+        }
+
+        m_usage.metainfo_bytes += sizeof(metainfo_type);
+        m_usage.metainfo_bytes +=
+            string_heap_bytes(p_meta->primary_handle_prefix) + string_heap_bytes(p_meta->secondary_handle_prefix);
+        for (const auto& entry : p_meta->named_handle_map) {
+            m_usage.metainfo_bytes += tree_node_overhead() + sizeof(entry);
+            m_usage.metainfo_bytes += string_heap_bytes(entry.first) + string_heap_bytes(entry.second);
+        }
+
+        // input buffers and key tables may be shared among the documents of a stream.
+        const std::string* p_input_buffer = p_meta->p_input_buffer.get();
+        if (p_input_buffer && m_counted_objects.insert(p_input_buffer).second) {
+            m_usage.metainfo_bytes += sizeof(std::string) + string_heap_bytes(*p_input_buffer);
+        }
+        const key_intern_table* p_key_table = p_meta->p_key_table.get();
+        if (p_key_table && m_counted_objects.insert(p_key_table).second) {
+            m_usage.metainfo_bytes += sizeof(key_intern_table) + p_key_table->memory_usage();
+        }
+
+        for (const auto& entry : p_meta->anchor_table) {
+            m_usage.anchor_table_bytes += tree_node_overhead() + sizeof(entry) + string_heap_bytes(entry.first);
+
+            // the anchored values are attributed to the anchor table as a whole.
+            node_memory_usage anchored {};
+            count_node(entry.second, anchored);
+            m_usage.anchor_table_bytes += anchored.total();
+        }
+    }
+
+    /// @brief Get the bytes of the heap-allocated payload of the given string.
+    /// @tparam StringT A string type.
+    /// @param s A string.
+    /// @return std::size_t The bytes of the payload, or 0 if the string is stored in place.
+    template <typename StringT>
+    static std::size_t string_heap_bytes(const StringT& s) noexcept {
+        // default constructed strings have the capacity of the small string optimization buffer.
+        static const std::size_t sso_capacity = StringT().capacity();
+        return s.capacity() > sso_capacity ? (s.capacity() + 1) * sizeof(typename StringT::value_type) : 0;
+    }
+
+    /// @brief Get the bytes of unused capacity of the given container.
+    /// @tparam ContainerType A container type with the capacity() function, e.g., std::vector.
+    /// @param c A container.
+    /// @return std::size_t The bytes of unused capacity.
+    template <typename ContainerType, enable_if_t<has_capacity<ContainerType>::value, int> = 0>
+    static std::size_t capacity_slack(const ContainerType& c) noexcept {
+        return (c.capacity() - c.size()) * sizeof(typename ContainerType::value_type);
+    }
+
+    /// @brief Get the bytes of unused capacity of the given node-based container, which is always 0.
+    /// @tparam ContainerType A container type without the capacity() function, e.g., std::map.
+    /// @return std::size_t 0
+    template <typename ContainerType, enable_if_t<!has_capacity<ContainerType>::value, int> = 0>
+    static std::size_t capacity_slack(const ContainerType& /*unused*/) noexcept {
+        return 0;
+    }
+
+    /// @brief Get the bytes of bookkeeping data for each element of the given container.
+    /// @tparam ContainerType A container type with the capacity() function, e.g., std::vector.
+    /// @return std::size_t 0 since elements are stored contiguously.
+    template <typename ContainerType, enable_if_t<has_capacity<ContainerType>::value, int> = 0>
+    static std::size_t element_overhead(const ContainerType& /*unused*/) noexcept {
+        return 0;
+    }
+
+    /// @brief Get the bytes of bookkeeping data for each element of the given node-based container.
+    /// @tparam ContainerType A container type without the capacity() function, e.g., std::map.
+    /// @return std::size_t The estimated bytes of the links and the color of a red-black tree node.
+    template <typename ContainerType, enable_if_t<!has_capacity<ContainerType>::value, int> = 0>
+    static std::size_t element_overhead(const ContainerType& /*unused*/) noexcept {
+        return tree_node_overhead();
+    }
+
+    /// @brief Get the estimated bytes of bookkeeping data of a node of std::map and std::multimap.
+    /// @return std::size_t The bytes of three links and a color.
+    static constexpr std::size_t tree_node_overhead() noexcept {
+        return 4 * sizeof(void*);
+    }
+
+    /// The report being accumulated.
+    node_memory_usage m_usage {};
+    /// The shared objects which have already been counted.
+    std::set<const void*> m_counted_objects {};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_NODE_MEMORY_COUNTER_HPP */
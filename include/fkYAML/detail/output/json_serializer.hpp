@@ -0,0 +1,361 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_OUTPUT_JSON_SERIALIZER_HPP
+#define FK_YAML_DETAIL_OUTPUT_JSON_SERIALIZER_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/output/output_adapter.hpp>
+#include <fkYAML/detail/str_view.hpp>
+#include <fkYAML/exception.hpp>
+#include <fkYAML/node_type.hpp>
+
+#if FK_YAML_HAS_TO_CHARS
+// Prefer std::to_chars() which produces the shortest round-trip representation of floating point numbers.
+#include <charconv>
+#endif
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief A basic implementation of serialization feature for YAML nodes in the JSON format.
+/// @note Since JSON has no counterpart for YAML node properties, anchors and tags are dropped and aliases are
+/// expanded into the values of their anchors.
+/// @tparam BasicNodeType A BasicNode template class instantiation.
+template <typename BasicNodeType>
+class basic_json_serializer {
+    static_assert(detail::is_basic_node<BasicNodeType>::value, "basic_json_serializer only accepts basic_node<...>");
+
+    /// @brief The number of spaces for one indentation level in the pretty-printed output.
+    static constexpr uint32_t indent_width = 2;
+
+public:
+    /// @brief Construct a new basic_json_serializer object.
+    /// @param pretty Whether to pretty-print the output with newlines and indentation.
+    explicit basic_json_serializer(bool pretty = false) noexcept
+        : m_pretty(pretty) {
+    }
+
+    /// @brief Serialize the given Node value into a JSON string.
+    /// @param node A Node object to be serialized.
+    /// @return std::string A serialization result of the given Node value.
+    std::string serialize(const BasicNodeType& node) {
+        std::string str {};
+        string_output_adapter out(str);
+        serialize_node(node, 0, out);
+        return str;
+    } // LCOV_EXCL_LINE
+
+    /// @brief Serialize the given Node value into an output stream in the JSON format.
+    /// @param node A Node object to be serialized.
+    /// @param os An output stream to which the serialization result is written.
+    void serialize(const BasicNodeType& node, std::ostream& os) {
+        stream_output_adapter out(os);
+        serialize_node(node, 0, out);
+        out.flush();
+    }
+
+private:
+    /// @brief Recursively serialize each Node object.
+    /// @tparam OutputAdapterType The type of an output adapter.
+    /// @param node A Node object to be serialized.
+    /// @param cur_indent The current indentation width.
+    /// @param out An output adapter to which the serialization result is written.
+    template <typename OutputAdapterType>
+    void serialize_node(const BasicNodeType& node, const uint32_t cur_indent, OutputAdapterType& out) {
+        switch (node.get_type()) {
+        case node_type::SEQUENCE: {
+            const auto& seq = node.template get_value_ref<const typename BasicNodeType::sequence_type&>();
+            if (seq.empty()) {
+                out.write("[]", 2);
+                break;
+            }
+
+            out.write('[');
+            bool is_first = true;
+            for (const auto& item : seq) {
+                if (!is_first) {
+                    out.write(',');
+                }
+                is_first = false;
+                write_newline_and_indent(cur_indent + indent_width, out);
+                serialize_node(item, cur_indent + indent_width, out);
+            }
+            write_newline_and_indent(cur_indent, out);
+            out.write(']');
+            break;
+        }
+        case node_type::MAPPING: {
+            const auto& map = node.template get_value_ref<const typename BasicNodeType::mapping_type&>();
+            if (map.empty()) {
+                out.write("{}", 2);
+                break;
+            }
+
+            out.write('{');
+            bool is_first = true;
+            for (const auto& pair : map) {
+                if (!is_first) {
+                    out.write(',');
+                }
+                is_first = false;
+                write_newline_and_indent(cur_indent + indent_width, out);
+                serialize_key(pair.first, out);
+                if (m_pretty) {
+                    out.write(": ", 2);
+                }
+                else {
+                    out.write(':');
+                }
+                serialize_node(pair.second, cur_indent + indent_width, out);
+            }
+            write_newline_and_indent(cur_indent, out);
+            out.write('}');
+            break;
+        }
+        case node_type::NULL_OBJECT:
+            out.write("null", 4);
+            break;
+        case node_type::BOOLEAN:
+            if (node.template get_value<typename BasicNodeType::boolean_type>()) {
+                out.write("true", 4);
+            }
+            else {
+                out.write("false", 5);
+            }
+            break;
+        case node_type::INTEGER:
+            write_integer(node.template get_value<typename BasicNodeType::integer_type>(), out);
+            break;
+        case node_type::FLOAT:
+            write_float(node.template get_value<typename BasicNodeType::float_number_type>(), out);
+            break;
+        case node_type::STRING:
+            write_string(node.template get_value<str_view>(), out);
+            break;
+        }
+    }
+
+    /// @brief Serialize a mapping key. Non-string scalar keys are written as JSON strings of their textual forms.
+    /// @tparam OutputAdapterType The type of an output adapter.
+    /// @param key A mapping key to be serialized.
+    /// @param out An output adapter to which the serialization result is written.
+    template <typename OutputAdapterType>
+    void serialize_key(const BasicNodeType& key, OutputAdapterType& out) {
+        switch (key.get_type()) {
+        case node_type::SEQUENCE:
+        case node_type::MAPPING:
+            throw type_error("JSON object keys must be scalars.", key.get_type());
+        case node_type::STRING:
+            write_string(key.template get_value<str_view>(), out);
+            break;
+        default:
+            // null, boolean and number tokens never contain characters which need to be escaped.
+            out.write('\"');
+            serialize_node(key, 0, out);
+            out.write('\"');
+            break;
+        }
+    }
+
+    /// @brief Write a newline code and the indentation if the output is pretty-printed. Do nothing otherwise.
+    /// @tparam OutputAdapterType The type of an output adapter.
+    /// @param indent The indentation width.
+    /// @param out An output adapter to which the serialization result is written.
+    template <typename OutputAdapterType>
+    void write_newline_and_indent(const uint32_t indent, OutputAdapterType& out) {
+        if (m_pretty) {
+            out.write('\n');
+            for (uint32_t i = 0; i < indent; i++) {
+                out.write(' ');
+            }
+        }
+    }
+
+    /// @brief Write an integer value in the decimal format.
+    /// @tparam IntegerType The type of the integer value.
+    /// @tparam OutputAdapterType The type of an output adapter.
+    /// @param i An integer value to be written.
+    /// @param out An output adapter to which the serialization result is written.
+    template <typename IntegerType, typename OutputAdapterType>
+    void write_integer(IntegerType i, OutputAdapterType& out) {
+        using unsigned_type = typename std::make_unsigned<IntegerType>::type;
+
+        // enough for the decimal digits of any 64-bit integer with the sign.
+        char buff[24];
+        char* p_end = &buff[0] + sizeof(buff);
+        char* p_cur = p_end;
+
+        bool is_negative = i < 0;
+        // negate in the unsigned domain to avoid an overflow with the minimum value.
+        unsigned_type u = is_negative ? static_cast<unsigned_type>(0 - static_cast<unsigned_type>(i))
+                                      : static_cast<unsigned_type>(i);
+        do {
+            *--p_cur = static_cast<char>('0' + u % 10);
+            u /= 10;
+        } while (u != 0);
+
+        if (is_negative) {
+            *--p_cur = '-';
+        }
+
+        out.write(p_cur, static_cast<std::size_t>(p_end - p_cur));
+    }
+
+    /// @brief Write a floating point number value in its shortest round-trip representation.
+    /// @note JSON cannot represent NaN and infinities, so they are written as null.
+    /// @tparam FloatType The type of the floating point number value.
+    /// @tparam OutputAdapterType The type of an output adapter.
+    /// @param f A floating point number value to be written.
+    /// @param out An output adapter to which the serialization result is written.
+    template <typename FloatType, typename OutputAdapterType>
+    void write_float(FloatType f, OutputAdapterType& out) {
+        if (std::isnan(f) || std::isinf(f)) {
+            out.write("null", 4);
+            return;
+        }
+
+        char buff[64];
+        std::size_t len = format_float(f, &buff[0], sizeof(buff));
+
+        // If `f` is actually an integer, ".0" must be appended so that the value is read back as a float.
+        bool is_integral = true;
+        for (std::size_t i = 0; i < len; i++) {
+            char c = buff[i];
+            if (c == '.' || c == 'e' || c == 'E') {
+                is_integral = false;
+                break;
+            }
+        }
+
+        out.write(&buff[0], len);
+        if (is_integral) {
+            out.write(".0", 2);
+        }
+    }
+
+    /// @brief Format a floating point number value into the buffer in its shortest round-trip representation.
+    /// @tparam FloatType The type of the floating point number value.
+    /// @param f A finite floating point number value.
+    /// @param p_buff The output buffer.
+    /// @param size The size of the output buffer.
+    /// @return std::size_t The number of the written characters.
+    template <typename FloatType>
+    static std::size_t format_float(FloatType f, char* p_buff, std::size_t size) {
+#if FK_YAML_HAS_TO_CHARS
+        std::to_chars_result res = std::to_chars(p_buff, p_buff + size, f);
+        return static_cast<std::size_t>(res.ptr - p_buff);
+#else
+        // Try increasing precisions until the formatted value is read back to the original one.
+        // Both snprintf() and strtold() follow the decimal point of the current LC_NUMERIC locale.
+        using limits = std::numeric_limits<FloatType>;
+        const long double ld = static_cast<long double>(f);
+        int len = 0;
+        for (int precision = limits::digits10; precision <= limits::max_digits10; precision++) {
+            len = std::snprintf(p_buff, size, "%.*Lg", precision, ld);
+            if (static_cast<FloatType>(std::strtold(p_buff, nullptr)) == f) {
+                break;
+            }
+        }
+        return normalize_decimal_point(p_buff, static_cast<std::size_t>(len));
+#endif
+    }
+
+    /// @brief Replace a locale-specific decimal point (possibly multibyte, e.g., ',') in a formatted number with '.'.
+    /// @param p_buff The buffer of a number formatted with the "%g" conversion.
+    /// @param len The length of the formatted number.
+    /// @return std::size_t The length of the normalized number.
+    static std::size_t normalize_decimal_point(char* p_buff, std::size_t len) noexcept {
+        // "%g" never groups digits, so any other characters than digits, signs and exponents are a decimal point.
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < len; i++) {
+            const char c = p_buff[i];
+            const bool is_numeric = (c >= '0' && c <= '9') || c == '-' || c == '+' || c == 'e' || c == 'E';
+            if (is_numeric) {
+                p_buff[pos++] = c;
+            }
+            else if (pos == 0 || p_buff[pos - 1] != '.') {
+                p_buff[pos++] = '.';
+            }
+        }
+        return pos;
+    }
+
+    /// @brief Write a string value as a JSON string with necessary escapes.
+    /// @tparam StringType The type of the string value.
+    /// @tparam OutputAdapterType The type of an output adapter.
+    /// @param s A string value to be written.
+    /// @param out An output adapter to which the serialization result is written.
+    template <typename StringType, typename OutputAdapterType>
+    void write_string(const StringType& s, OutputAdapterType& out) {
+        out.write('\"');
+
+        const char* p_cur = s.data();
+        const char* p_end = p_cur + s.size();
+        const char* p_chunk_begin = p_cur;
+
+        for (; p_cur != p_end; ++p_cur) {
+            const auto c = static_cast<uint8_t>(*p_cur);
+            if FK_YAML_LIKELY (c >= 0x20u && c != '\"' && c != '\\') {
+                // Characters which need no escape are written in bulk.
+                continue;
+            }
+
+            out.write(p_chunk_begin, static_cast<std::size_t>(p_cur - p_chunk_begin));
+            p_chunk_begin = p_cur + 1;
+
+            switch (c) {
+            case '\"':
+                out.write("\\\"", 2);
+                break;
+            case '\\':
+                out.write("\\\\", 2);
+                break;
+            case '\b':
+                out.write("\\b", 2);
+                break;
+            case '\f':
+                out.write("\\f", 2);
+                break;
+            case '\n':
+                out.write("\\n", 2);
+                break;
+            case '\r':
+                out.write("\\r", 2);
+                break;
+            case '\t':
+                out.write("\\t", 2);
+                break;
+            default: {
+                static constexpr char hex_digits[] = "0123456789ABCDEF";
+                char escaped[6] = {'\\', 'u', '0', '0', hex_digits[c >> 4], hex_digits[c & 0xFu]};
+                out.write(&escaped[0], 6);
+                break;
+            }
+            }
+        }
+
+        out.write(p_chunk_begin, static_cast<std::size_t>(p_end - p_chunk_begin));
+        out.write('\"');
+    }
+
+    /// Whether to pretty-print the output.
+    bool m_pretty {false};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_OUTPUT_JSON_SERIALIZER_HPP */
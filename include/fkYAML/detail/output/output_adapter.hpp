@@ -0,0 +1,122 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_OUTPUT_OUTPUT_ADAPTER_HPP
+#define FK_YAML_DETAIL_OUTPUT_OUTPUT_ADAPTER_HPP
+
+#include <cstring>
+#include <ostream>
+#include <string>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+////////////////////////
+//   output_adapter   //
+////////////////////////
+
+/// @brief An output adapter which appends characters to a std::string object.
+class string_output_adapter {
+public:
+    /// @brief Construct a new string_output_adapter object.
+    /// @param str A reference to the output string.
+    explicit string_output_adapter(std::string& str) noexcept
+        : m_str(str) {
+    }
+
+    /// @brief Write a single character to the output string.
+    /// @param c A character to be written.
+    void write(char c) {
+        m_str.push_back(c);
+    }
+
+    /// @brief Write the given characters to the output string.
+    /// @param p_chars A pointer to the first character to be written.
+    /// @param len The number of characters to be written.
+    void write(const char* p_chars, std::size_t len) {
+        m_str.append(p_chars, len);
+    }
+
+    /// @brief Flush the written characters. (Nothing to do for strings.)
+    void flush() noexcept {
+    }
+
+private:
+    /// The reference to the output string.
+    std::string& m_str;
+};
+
+/// @brief An output adapter which writes characters to a std::ostream object.
+/// @note Characters are stored into a fixed-size internal buffer first so that the output stream receives few, large
+/// write requests instead of per-character ones.
+class stream_output_adapter {
+public:
+    /// @brief Construct a new stream_output_adapter object.
+    /// @param os A reference to the output stream.
+    explicit stream_output_adapter(std::ostream& os) noexcept
+        : m_os(os) {
+    }
+
+    // disable copy construction/assignment since the buffered contents would be written twice.
+    stream_output_adapter(const stream_output_adapter&) = delete;
+    stream_output_adapter& operator=(const stream_output_adapter&) = delete;
+
+    /// @brief Destroy the stream_output_adapter object after writing the buffered characters.
+    ~stream_output_adapter() {
+        flush();
+    }
+
+    /// @brief Write a single character to the output stream.
+    /// @param c A character to be written.
+    void write(char c) {
+        if FK_YAML_UNLIKELY (m_size == buffer_size) {
+            flush();
+        }
+        m_buffer[m_size++] = c;
+    }
+
+    /// @brief Write the given characters to the output stream.
+    /// @param p_chars A pointer to the first character to be written.
+    /// @param len The number of characters to be written.
+    void write(const char* p_chars, std::size_t len) {
+        if (m_size + len > buffer_size) {
+            flush();
+            if (len > buffer_size) {
+                // write large contents directly to avoid an extra copy.
+                m_os.write(p_chars, static_cast<std::streamsize>(len));
+                return;
+            }
+        }
+        std::memcpy(&m_buffer[m_size], p_chars, len);
+        m_size += len;
+    }
+
+    /// @brief Write the buffered characters to the output stream.
+    void flush() {
+        if (m_size > 0) {
+            m_os.write(&m_buffer[0], static_cast<std::streamsize>(m_size));
+            m_size = 0;
+        }
+    }
+
+private:
+    /// The size of the internal buffer.
+    static constexpr std::size_t buffer_size = 1024;
+
+    /// The reference to the output stream.
+    std::ostream& m_os;
+    /// The internal buffer for output characters.
+    char m_buffer[buffer_size] {};
+    /// The number of buffered characters.
+    std::size_t m_size {0};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_OUTPUT_OUTPUT_ADAPTER_HPP */
@@ -19,6 +19,7 @@
 #include <fkYAML/detail/encodings/yaml_escaper.hpp>
 #include <fkYAML/detail/input/scalar_scanner.hpp>
 #include <fkYAML/detail/meta/node_traits.hpp>
+#include <fkYAML/detail/str_view.hpp>
 #include <fkYAML/exception.hpp>
 #include <fkYAML/node_type.hpp>
 #include <fkYAML/yaml_version_type.hpp>
@@ -341,9 +342,8 @@ private:
     typename BasicNodeType::string_type get_string_node_value(const BasicNodeType& node, bool& is_escaped) {
         FK_YAML_ASSERT(node.is_string());
 
-        using string_type = typename BasicNodeType::string_type;
-        const string_type& s = node.template get_value_ref<const string_type&>();
-        return yaml_escaper::escape(s.c_str(), s.c_str() + s.size(), is_escaped);
+        str_view s = node.template get_value<str_view>();
+        return yaml_escaper::escape(s.begin(), s.end(), is_escaped);
     } // LCOV_EXCL_LINE
 
 private:
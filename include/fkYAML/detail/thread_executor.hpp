@@ -0,0 +1,60 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_DETAIL_THREAD_EXECUTOR_HPP
+#define FK_YAML_DETAIL_THREAD_EXECUTOR_HPP
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+
+FK_YAML_DETAIL_NAMESPACE_BEGIN
+
+/// @brief An executor which runs each given task on a dedicated thread.
+/// @note All the threads are joined when the executor is destroyed.
+class thread_executor {
+public:
+    /// @brief Construct a new thread_executor object.
+    thread_executor() = default;
+
+    // disable copy/move construction/assignment since the running threads must be joined only once.
+    thread_executor(const thread_executor&) = delete;
+    thread_executor(thread_executor&&) = delete;
+    thread_executor& operator=(const thread_executor&) = delete;
+    thread_executor& operator=(thread_executor&&) = delete;
+
+    /// @brief Destroy the thread_executor object after joining all the running threads.
+    ~thread_executor() {
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    /// @brief Run the given task on a new thread.
+    /// @param task A task to be run.
+    void operator()(std::function<void()> task) {
+        m_threads.emplace_back(std::move(task));
+    }
+
+    /// @brief Get the recommended number of concurrent tasks on this system.
+    /// @return std::size_t The number of concurrent threads supported. (at least 1)
+    static std::size_t default_concurrency() noexcept {
+        unsigned int n = std::thread::hardware_concurrency();
+        return (n > 0) ? static_cast<std::size_t>(n) : 1;
+    }
+
+private:
+    /// The running threads.
+    std::vector<std::thread> m_threads {};
+};
+
+FK_YAML_DETAIL_NAMESPACE_END
+
+#endif /* FK_YAML_DETAIL_THREAD_EXECUTOR_HPP */
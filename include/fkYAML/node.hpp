@@ -23,31 +23,40 @@
 #include <fkYAML/detail/assert.hpp>
 #include <fkYAML/detail/document_metainfo.hpp>
 #include <fkYAML/detail/input/deserializer.hpp>
+#include <fkYAML/detail/input/document_stream.hpp>
 #include <fkYAML/detail/input/input_adapter.hpp>
 #include <fkYAML/detail/iterator.hpp>
+#include <fkYAML/detail/macros/define_type_macros.hpp>
 #include <fkYAML/detail/meta/node_traits.hpp>
 #include <fkYAML/detail/meta/stl_supplement.hpp>
 #include <fkYAML/detail/meta/type_traits.hpp>
 #include <fkYAML/detail/node_attrs.hpp>
+#include <fkYAML/detail/node_memory_counter.hpp>
 #include <fkYAML/detail/node_property.hpp>
 #include <fkYAML/detail/node_ref_storage.hpp>
+#include <fkYAML/detail/output/json_serializer.hpp>
 #include <fkYAML/detail/output/serializer.hpp>
+#include <fkYAML/detail/thread_executor.hpp>
 #include <fkYAML/detail/types/node_t.hpp>
 #include <fkYAML/detail/types/yaml_version_t.hpp>
 #include <fkYAML/exception.hpp>
+#include <fkYAML/node_fwd.hpp>
+#include <fkYAML/node_memory_usage.hpp>
 #include <fkYAML/node_type.hpp>
 #include <fkYAML/node_value_converter.hpp>
 #include <fkYAML/ordered_map.hpp>
+#include <fkYAML/parse_stats.hpp>
+#include <fkYAML/parser.hpp>
 
 FK_YAML_NAMESPACE_BEGIN
 
 /// @brief A class to store value of YAML nodes.
 /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/
+/// @note The default template arguments are declared in <fkYAML/node_fwd.hpp>.
 template <
-    template <typename, typename...> class SequenceType = std::vector,
-    template <typename, typename, typename...> class MappingType = std::map, typename BooleanType = bool,
-    typename IntegerType = std::int64_t, typename FloatNumberType = double, typename StringType = std::string,
-    template <typename, typename = void> class ConverterType = node_value_converter>
+    template <typename, typename...> class SequenceType, template <typename, typename, typename...> class MappingType,
+    typename BooleanType, typename IntegerType, typename FloatNumberType, typename StringType,
+    template <typename, typename = void> class ConverterType>
 class basic_node {
 public:
     /// @brief A type for iterators of basic_node containers.
@@ -83,6 +92,10 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/string_type/
     using string_type = StringType;
 
+    /// @brief A type for tables of mapping key strings shared by deserialized YAML documents.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/key_intern_table_type/
+    using key_intern_table_type = detail::key_intern_table;
+
     /// @brief A helper alias to determine converter type for the given target native data type.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/value_converter_type/
     template <typename T, typename SFINAE>
@@ -102,16 +115,29 @@ private:
     template <node_type>
     friend struct fkyaml::detail::external_node_constructor;
 
+    friend struct fkyaml::detail::external_node_string_view;
+
     template <typename BasicNodeType>
     friend class fkyaml::detail::basic_deserializer;
 
+    template <typename BasicNodeType>
+    friend class fkyaml::detail::json_subset_parser;
+
+    template <typename BasicNodeType>
+    friend class fkyaml::detail::scalar_parser;
+
     template <typename BasicNodeType>
     friend class fkyaml::detail::basic_serializer;
 
+    template <typename BasicNodeType>
+    friend class fkyaml::detail::node_memory_counter;
+
     /// @brief A type for YAML docs deserializers.
     using deserializer_type = detail::basic_deserializer<basic_node>;
     /// @brief A type for YAML docs serializers.
     using serializer_type = detail::basic_serializer<basic_node>;
+    /// @brief A type for JSON serializers.
+    using json_serializer_type = detail::basic_json_serializer<basic_node>;
     /// @brief A helper type alias for std::initializer_list.
     using initializer_list_t = std::initializer_list<detail::node_ref_storage<basic_node>>;
 
@@ -156,9 +182,15 @@ private:
 
         /// @brief Destroys the existing Node value. This process is recursive if the specified node type is for
         /// containers.
-        /// @param[in] type A Node type to determine the value to be destroyed.
-        void destroy(detail::node_attr_t value_type_bit) {
-            switch (value_type_bit) {
+        /// @param[in] attrs Node attributes to determine the value to be destroyed.
+        void destroy(detail::node_attr_t attrs) {
+            if (attrs & detail::node_attr_bits::borrowed_str_bit) {
+                // borrowed strings are owned by someone else.
+                p_borrowed_str = nullptr;
+                return;
+            }
+
+            switch (attrs & detail::node_attr_mask::value) {
             case detail::node_attr_bits::seq_bit:
                 p_sequence->clear();
                 destroy_object<sequence_type>(p_sequence);
@@ -190,6 +222,8 @@ private:
         float_number_type float_val;
         /// A pointer to the value of string type.
         string_type* p_string;
+        /// A pointer to the first character of a borrowed string. Its size is stored outside this union.
+        const char* p_borrowed_str;
     };
 
 private:
@@ -251,6 +285,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
     basic_node(const basic_node& rhs)
         : m_attrs(rhs.m_attrs),
+          m_borrowed_str_size(rhs.m_borrowed_str_size),
           mp_meta(rhs.mp_meta),
           m_prop(rhs.m_prop) {
         if FK_YAML_LIKELY (!has_anchor_name()) {
@@ -274,6 +309,10 @@ public:
                 m_node_value.float_val = rhs.m_node_value.float_val;
                 break;
             case detail::node_attr_bits::string_bit:
+                if (m_attrs & detail::node_attr_bits::borrowed_str_bit) {
+                    m_node_value.p_borrowed_str = rhs.m_node_value.p_borrowed_str;
+                    break;
+                }
                 m_node_value.p_string = create_object<string_type>(*(rhs.m_node_value.p_string));
                 break;
             default:   // LCOV_EXCL_LINE
@@ -287,6 +326,7 @@ public:
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/constructor/
     basic_node(basic_node&& rhs) noexcept
         : m_attrs(rhs.m_attrs),
+          m_borrowed_str_size(rhs.m_borrowed_str_size),
           mp_meta(std::move(rhs.mp_meta)),
           m_prop(std::move(rhs.m_prop)) {
         if FK_YAML_LIKELY (!has_anchor_name()) {
@@ -318,6 +358,7 @@ public:
                 rhs.m_node_value.float_val = static_cast<float_number_type>(0.0);
                 break;
             case detail::node_attr_bits::string_bit:
+                // a borrowed string is moved in the same way since its pointer shares the storage.
                 FK_YAML_ASSERT(rhs.m_node_value.p_string != nullptr);
                 m_node_value.p_string = rhs.m_node_value.p_string;
                 rhs.m_node_value.p_string = nullptr;
@@ -328,6 +369,7 @@ public:
         }
 
         rhs.m_attrs = detail::node_attr_bits::default_bits;
+        rhs.m_borrowed_str_size = 0;
         rhs.m_node_value.p_mapping = nullptr;
     }
 
@@ -396,13 +438,13 @@ public:
             if (m_attrs & detail::node_attr_bits::anchor_bit) {
                 auto itr = mp_meta->anchor_table.equal_range(m_prop.anchor).first;
                 std::advance(itr, detail::node_attr_bits::get_anchor_offset(m_attrs));
-                itr->second.m_node_value.destroy(itr->second.m_attrs & detail::node_attr_mask::value);
+                itr->second.m_node_value.destroy(itr->second.m_attrs);
                 itr->second.m_attrs = detail::node_attr_bits::default_bits;
                 itr->second.mp_meta.reset();
             }
         }
         else if ((m_attrs & detail::node_attr_bits::null_bit) == 0) {
-            m_node_value.destroy(m_attrs & detail::node_attr_mask::value);
+            m_node_value.destroy(m_attrs);
         }
 
         m_attrs = detail::node_attr_bits::default_bits;
@@ -420,6 +462,19 @@ public:
         return deserializer_type().deserialize(detail::input_adapter(std::forward<InputType>(input)));
     }
 
+    /// @brief Deserialize the first YAML document in the input into a basic_node object with mapping keys interned.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] p_key_table A table to intern mapping key strings into. If null, mapping keys are not interned.
+    /// @return The resulting basic_node object deserialized from the input source.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize/
+    template <typename InputType>
+    static basic_node deserialize(InputType&& input, std::shared_ptr<key_intern_table_type> p_key_table) {
+        deserializer_type deserializer {};
+        deserializer.set_key_intern_table(std::move(p_key_table));
+        return deserializer.deserialize(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
     /// @brief Deserialize the first YAML document in the input ranged by the iterators into a basic_node object.
     /// @tparam ItrType Type of a compatible iterator.
     /// @param[in] begin An iterator to the first element of an input sequence.
@@ -432,6 +487,83 @@ public:
             detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
     }
 
+    /// @brief Deserialize the first YAML document in the input into a basic_node object whose string values may refer
+    /// to the input.
+    /// @warning The input must outlive the resulting basic_node object and its copies.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @return The resulting basic_node object deserialized from the input source.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_in_place/
+    template <typename InputType>
+    static basic_node deserialize_in_place(InputType&& input) {
+        static_assert(
+            std::is_lvalue_reference<InputType>::value || std::is_pointer<detail::remove_cvref_t<InputType>>::value,
+            "The input of deserialize_in_place() must not be a temporary object.");
+        return deserializer_type().deserialize_in_place(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Deserialize the first YAML document in the input ranged by the iterators into a basic_node object whose
+    /// string values may refer to the input.
+    /// @warning The input must outlive the resulting basic_node object and its copies.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @return The resulting basic_node object deserialized from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_in_place/
+    template <typename ItrType>
+    static basic_node deserialize_in_place(ItrType&& begin, ItrType&& end) {
+        return deserializer_type().deserialize_in_place(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
+    }
+
+    /// @brief Deserialize the first YAML document in the input into a basic_node object whose string values may refer
+    /// to a copy of the input kept alive by the resulting nodes.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @return The resulting basic_node object deserialized from the input source.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_borrowed/
+    template <typename InputType>
+    static basic_node deserialize_borrowed(InputType&& input) {
+        return deserializer_type().deserialize_borrowed(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Deserialize the first YAML document in the input ranged by the iterators into a basic_node object whose
+    /// string values may refer to a copy of the input kept alive by the resulting nodes.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @return The resulting basic_node object deserialized from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_borrowed/
+    template <typename ItrType>
+    static basic_node deserialize_borrowed(ItrType&& begin, ItrType&& end) {
+        return deserializer_type().deserialize_borrowed(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
+    }
+
+    /// @brief Deserialize the first YAML document in the input directly into a native data object.
+    /// @tparam T Type of the native data object.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @return The resulting native data object decoded from the input source.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_into/
+    template <typename T, typename InputType>
+    static T deserialize_into(InputType&& input) {
+        return deserializer_type().template deserialize_into<T>(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Deserialize the first YAML document in the input ranged by the iterators into a native data object.
+    /// @tparam T Type of the native data object.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @return The resulting native data object decoded from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_into/
+    template <typename T, typename ItrType>
+    static T deserialize_into(ItrType&& begin, ItrType&& end) {
+        return deserializer_type().template deserialize_into<T>(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
+    }
+
     /// @brief Deserialize all YAML documents in the input into basic_node objects.
     /// @tparam InputType Type of a compatible input.
     /// @param[in] input An input source in the YAML format.
@@ -442,6 +574,20 @@ public:
         return deserializer_type().deserialize_docs(detail::input_adapter(std::forward<InputType>(input)));
     }
 
+    /// @brief Deserialize all YAML documents in the input into basic_node objects with mapping keys interned.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] p_key_table A table to intern mapping key strings into. If null, mapping keys are not interned.
+    /// @return The resulting basic_node objects deserialized from the input.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_docs/
+    template <typename InputType>
+    static std::vector<basic_node> deserialize_docs(
+        InputType&& input, std::shared_ptr<key_intern_table_type> p_key_table) {
+        deserializer_type deserializer {};
+        deserializer.set_key_intern_table(std::move(p_key_table));
+        return deserializer.deserialize_docs(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
     /// @brief Deserialize all YAML documents in the input ranged by the iterators into basic_node objects.
     /// @tparam ItrType Type of a compatible iterator.
     /// @param[in] begin An iterator to the first element of an input sequence.
@@ -454,6 +600,89 @@ public:
             detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
     }
 
+    /// @brief Deserialize all YAML documents in the input into basic_node objects in parallel threads.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] num_threads The maximum number of threads. The number of concurrent threads supported by the system
+    /// is used if 0 is given.
+    /// @return The resulting basic_node objects deserialized from the input in the original order.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_docs_parallel/
+    template <typename InputType>
+    static std::vector<basic_node> deserialize_docs_parallel(InputType&& input, std::size_t num_threads = 0) {
+        if (num_threads == 0) {
+            num_threads = detail::thread_executor::default_concurrency();
+        }
+        detail::thread_executor executor {};
+        return deserializer_type().deserialize_docs_parallel(
+            detail::input_adapter(std::forward<InputType>(input)), executor, num_threads);
+    }
+
+    /// @brief Deserialize all YAML documents in the input into basic_node objects with tasks run by the executor.
+    /// @tparam InputType Type of a compatible input.
+    /// @tparam ExecutorType Type of an executor which accepts `std::function<void()>` tasks.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] executor An executor object which runs the given tasks, possibly in parallel.
+    /// @param[in] max_tasks The maximum number of tasks to be passed to the executor. The number of concurrent threads
+    /// supported by the system is used if 0 is given.
+    /// @return The resulting basic_node objects deserialized from the input in the original order.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/deserialize_docs_parallel/
+    template <
+        typename InputType, typename ExecutorType,
+        detail::enable_if_t<!std::is_integral<detail::remove_cvref_t<ExecutorType>>::value, int> = 0>
+    static std::vector<basic_node> deserialize_docs_parallel(
+        InputType&& input, ExecutorType&& executor, std::size_t max_tasks = 0) {
+        if (max_tasks == 0) {
+            max_tasks = detail::thread_executor::default_concurrency();
+        }
+        return deserializer_type().deserialize_docs_parallel(
+            detail::input_adapter(std::forward<InputType>(input)), std::forward<ExecutorType>(executor), max_tasks);
+    }
+
+    /// @brief Create a range of YAML documents in the input, each of which is deserialized on demand.
+    /// @note The input must outlive the resulting range object.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @return A range object whose iterators deserialize one document per increment.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/document_stream/
+    template <typename InputType>
+    static auto document_stream(InputType&& input)
+        -> detail::basic_document_stream<basic_node, decltype(detail::input_adapter(std::forward<InputType>(input)))> {
+        using adapter_type = decltype(detail::input_adapter(std::forward<InputType>(input)));
+        return detail::basic_document_stream<basic_node, adapter_type>(
+            detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Create a range of YAML documents in the input, each of which is deserialized on demand with mapping keys
+    /// interned.
+    /// @note The input must outlive the resulting range object.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @param[in] p_key_table A table to intern mapping key strings into. If null, mapping keys are not interned.
+    /// @return A range object whose iterators deserialize one document per increment.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/document_stream/
+    template <typename InputType>
+    static auto document_stream(InputType&& input, std::shared_ptr<key_intern_table_type> p_key_table)
+        -> detail::basic_document_stream<basic_node, decltype(detail::input_adapter(std::forward<InputType>(input)))> {
+        using adapter_type = decltype(detail::input_adapter(std::forward<InputType>(input)));
+        return detail::basic_document_stream<basic_node, adapter_type>(
+            detail::input_adapter(std::forward<InputType>(input)), std::move(p_key_table));
+    }
+
+    /// @brief Create a range of YAML documents in the input, each of which is deserialized on demand.
+    /// @note The input must outlive the resulting range object.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @return A range object whose iterators deserialize one document per increment.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/document_stream/
+    template <typename ItrType>
+    static auto document_stream(ItrType&& begin, ItrType&& end) -> detail::basic_document_stream<
+        basic_node, decltype(detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)))> {
+        using adapter_type = decltype(detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
+        return detail::basic_document_stream<basic_node, adapter_type>(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
+    }
+
     /// @brief Serialize a basic_node object into a string.
     /// @param[in] node A basic_node object to be serialized.
     /// @return The resulting string object from the serialization of the given node.
@@ -470,6 +699,24 @@ public:
         return serializer_type().serialize_docs(docs);
     }
 
+    /// @brief Serialize a basic_node object into a string in the JSON format.
+    /// @param[in] node A basic_node object to be serialized.
+    /// @param[in] pretty Whether to pretty-print the output with newlines and indentation.
+    /// @return The resulting JSON string from the serialization of the given node.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/serialize_json/
+    static std::string serialize_json(const basic_node& node, bool pretty = false) {
+        return json_serializer_type(pretty).serialize(node);
+    }
+
+    /// @brief Serialize a basic_node object into an output stream in the JSON format.
+    /// @param[in] node A basic_node object to be serialized.
+    /// @param[out] os An output stream to which the resulting JSON string is written.
+    /// @param[in] pretty Whether to pretty-print the output with newlines and indentation.
+    /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/serialize_json/
+    static void serialize_json(const basic_node& node, std::ostream& os, bool pretty = false) {
+        json_serializer_type(pretty).serialize(node, os);
+    }
+
     /// @brief A factory method for sequence basic_node objects without sequence_type objects.
     /// @return A YAML sequence node.
     /// @sa https://fktn-k.github.io/fkYAML/api/basic_node/sequence/
@@ -725,9 +972,13 @@ public:
                 (std::abs(this_node_value_ptr->float_val - other_node_value_ptr->float_val) <
                  std::numeric_limits<float_number_type>::epsilon());
             break;
-        case detail::node_attr_bits::string_bit:
-            ret = (*(this_node_value_ptr->p_string) == *(other_node_value_ptr->p_string));
+        case detail::node_attr_bits::string_bit: {
+            detail::str_view this_str = get_str_view();
+            detail::str_view other_str = rhs.get_str_view();
+            // interned mapping keys are equal if and only if they share the same characters.
+            ret = (this_str.data() == other_str.data() && this_str.size() == other_str.size()) || this_str == other_str;
             break;
+        }
         default:   // LCOV_EXCL_LINE
             break; // LCOV_EXCL_LINE
         }
@@ -787,9 +1038,13 @@ public:
         case detail::node_attr_bits::float_bit:
             ret = (p_this_value->float_val < p_other_value->float_val);
             break;
-        case detail::node_attr_bits::string_bit:
-            ret = (*(p_this_value->p_string) < *(p_other_value->p_string));
+        case detail::node_attr_bits::string_bit: {
+            detail::str_view this_str = get_str_view();
+            detail::str_view other_str = rhs.get_str_view();
+            // interned mapping keys which share the same characters are equal.
+            ret = (this_str.data() != other_str.data() || this_str.size() != other_str.size()) && this_str < other_str;
             break;
+        }
         default:   // LCOV_EXCL_LINE
             break; // LCOV_EXCL_LINE
         }
@@ -925,11 +1180,8 @@ public:
             FK_YAML_ASSERT(p_node_value->p_mapping != nullptr);
             return p_node_value->p_mapping->empty();
         }
-        case detail::node_attr_bits::string_bit: {
-            const node_value* p_node_value = get_node_value_ptr();
-            FK_YAML_ASSERT(p_node_value->p_string != nullptr);
-            return p_node_value->p_string->empty();
-        }
+        case detail::node_attr_bits::string_bit:
+            return get_str_view().empty();
         default:
             throw fkyaml::type_error("The target node is not of a container type.", get_type());
         }
@@ -948,8 +1200,7 @@ public:
             FK_YAML_ASSERT(p_node_value->p_mapping != nullptr);
             return p_node_value->p_mapping->size();
         case detail::node_attr_bits::string_bit:
-            FK_YAML_ASSERT(p_node_value->p_string != nullptr);
-            return p_node_value->p_string->size();
+            return get_str_view().size();
         default:
             throw fkyaml::type_error("The target node is not of a container type.", get_type());
         }
@@ -1369,6 +1620,7 @@ public:
     void swap(basic_node& rhs) noexcept {
         using std::swap;
         swap(m_attrs, rhs.m_attrs);
+        swap(m_borrowed_str_size, rhs.m_borrowed_str_size);
         swap(mp_meta, rhs.mp_meta);
 
         node_value tmp {};
@@ -1465,6 +1717,17 @@ public:
     }
 
 private:
+    /// @brief Construct a new basic_node object of the given type which shares the given document metainfo.
+    /// @note This is used on deserialization so that each node doesn't allocate its own metainfo only to be replaced
+    /// with the one for the whole document.
+    /// @param type A YAML node type.
+    /// @param p_meta The metainfo of the document which the node belongs to.
+    basic_node(const node_type type, std::shared_ptr<detail::document_metainfo<basic_node>> p_meta)
+        : m_attrs(detail::node_attr_bits::from_node_type(type)),
+          mp_meta(std::move(p_meta)),
+          m_node_value(m_attrs & detail::node_attr_mask::value) {
+    }
+
     /// @brief Returns the pointer to the node_value object of either this node or the associated anchor node.
     /// @return The pointer to the node_value object of either this node or the associated anchor node.
     const node_value* get_node_value_ptr() const {
@@ -1590,23 +1853,63 @@ private:
     /// @return Reference to the string node value.
     string_type& get_value_ref_impl(string_type* /*unused*/) {
         if FK_YAML_LIKELY (m_attrs & detail::node_attr_bits::string_bit) {
+            materialize_borrowed_str();
             return *(m_node_value.p_string);
         }
         throw fkyaml::type_error("The node value is not a string.", get_type());
     }
 
     /// @brief Returns reference to the string node value.
-    /// @throw fkyaml::exception The node value is not a string.
+    /// @note Borrowed strings are not copied through constant references so that concurrent reads are safe.
+    /// @throw fkyaml::exception The node value is not an owned string.
     /// @return Constant reference to the string node value.
     const string_type& get_value_ref_impl(const string_type* /*unused*/) const {
-        if FK_YAML_LIKELY (m_attrs & detail::node_attr_bits::string_bit) {
+        if FK_YAML_LIKELY ((m_attrs & detail::node_attr_bits::string_bit) &&
+                           !(m_attrs & detail::node_attr_bits::borrowed_str_bit)) {
             return *(m_node_value.p_string);
         }
+        if (m_attrs & detail::node_attr_bits::string_bit) {
+            throw fkyaml::type_error(
+                "The borrowed string node value cannot be referenced through a constant node. "
+                "Use get_value<std::string>() or get_value<std::string_view>() instead.",
+                get_type());
+        }
         throw fkyaml::type_error("The node value is not a string.", get_type());
     }
 
+    /// @brief Returns the view of the string node value whether it's owned or borrowed.
+    /// @warning Make sure the node value is a string before calling this function.
+    /// @return The view of the string node value.
+    detail::str_view get_str_view() const noexcept {
+        const basic_node* p_node = this;
+        if (has_anchor_name()) {
+            auto itr = mp_meta->anchor_table.equal_range(m_prop.anchor).first;
+            std::advance(itr, detail::node_attr_bits::get_anchor_offset(m_attrs));
+            p_node = &(itr->second);
+        }
+
+        FK_YAML_ASSERT(p_node->m_attrs & detail::node_attr_bits::string_bit);
+        if (p_node->m_attrs & detail::node_attr_bits::borrowed_str_bit) {
+            return {p_node->m_node_value.p_borrowed_str, p_node->m_borrowed_str_size};
+        }
+        FK_YAML_ASSERT(p_node->m_node_value.p_string != nullptr);
+        return {p_node->m_node_value.p_string->data(), p_node->m_node_value.p_string->size()};
+    }
+
+    /// @brief Replaces a borrowed string node value with an owned copy so that it can be referenced as string_type.
+    void materialize_borrowed_str() {
+        if FK_YAML_LIKELY (!(m_attrs & detail::node_attr_bits::borrowed_str_bit)) {
+            return;
+        }
+        m_node_value.p_string = create_object<string_type>(m_node_value.p_borrowed_str, m_borrowed_str_size);
+        m_attrs &= ~detail::node_attr_bits::borrowed_str_bit;
+        m_borrowed_str_size = 0;
+    }
+
     /// The current node attributes.
     detail::node_attr_t m_attrs {detail::node_attr_bits::default_bits};
+    /// The size of the borrowed string node value. This fills the padding after m_attrs on 64-bit platforms.
+    uint32_t m_borrowed_str_size {0};
     /// The shared set of YAML directives applied to this node.
     mutable std::shared_ptr<detail::document_metainfo<basic_node>> mp_meta {
         std::shared_ptr<detail::document_metainfo<basic_node>>(new detail::document_metainfo<basic_node>())};
@@ -1667,9 +1970,23 @@ inline std::istream& operator>>(
     return is;
 }
 
-/// @brief default YAML node value container.
-/// @sa https://fktn-k.github.io/fkYAML/api/basic_node/node/
-using node = basic_node<>;
+/// @brief Estimate the memory footprint of a node tree in bytes by category.
+/// @note The document metainfo shared by the node tree is counted as a whole, including the input buffer and the key
+/// table which borrowed strings refer to, and the anchor table which holds the values of anchor and alias nodes.
+/// @param[in] n A basic_node object.
+/// @return The estimated bytes by category.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_memory_usage/memory_usage/
+template <
+    template <typename, typename...> class SequenceType, template <typename, typename, typename...> class MappingType,
+    typename BooleanType, typename IntegerType, typename FloatNumberType, typename StringType,
+    template <typename, typename = void> class ConverterType>
+inline node_memory_usage memory_usage(
+    const basic_node<SequenceType, MappingType, BooleanType, IntegerType, FloatNumberType, StringType, ConverterType>&
+        n) {
+    using node_type_ =
+        basic_node<SequenceType, MappingType, BooleanType, IntegerType, FloatNumberType, StringType, ConverterType>;
+    return detail::node_memory_counter<node_type_>().count(n);
+}
 
 /// @brief namespace for user-defined literals for the fkYAML library.
 inline namespace literals {
@@ -1716,6 +2033,35 @@ inline fkyaml::node operator"" _yaml(const char8_t* s, std::size_t n) {
 } // namespace yaml_literals
 } // namespace literals
 
+#ifdef FK_YAML_USE_COMPILED_LIBRARY
+// The following specializations for the default node type are explicitly instantiated in the compiled library, which
+// is built with the FK_YAML_BUILD_COMPILED_LIBRARY CMake option, so that they are not instantiated in each translation
+// unit. The list must be kept in sync with src/node.cpp.
+
+extern template class basic_node<>;
+extern template class basic_parser<node>;
+
+extern template node node::deserialize<std::string&>(std::string&);
+extern template node node::deserialize<const std::string&>(const std::string&);
+extern template node node::deserialize<const char*>(const char*&&, const char*&&);
+extern template std::vector<node> node::deserialize_docs<std::string&>(std::string&);
+extern template std::vector<node> node::deserialize_docs<const std::string&>(const std::string&);
+
+namespace detail {
+
+extern template class basic_deserializer<node>;
+extern template class basic_serializer<node>;
+extern template class basic_json_serializer<node>;
+extern template class scalar_parser<node>;
+extern template class json_subset_parser<node>;
+extern template class tag_resolver<node>;
+extern template class iterator<node>;
+extern template class iterator<const node>;
+extern template class node_memory_counter<node>;
+
+} // namespace detail
+#endif
+
 FK_YAML_NAMESPACE_END
 
 #endif /* FK_YAML_NODE_HPP */
@@ -0,0 +1,54 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_NODE_FWD_HPP
+#define FK_YAML_NODE_FWD_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+
+FK_YAML_NAMESPACE_BEGIN
+
+// This header only declares the public class templates and the default type aliases so that headers which just pass
+// node objects around by reference or pointer don't have to include the whole library. Include <fkYAML/node.hpp>
+// wherever the definitions are needed.
+
+/// @brief An ADL friendly converter between basic_node objects and native data objects.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_value_converter/
+template <typename ValueType, typename>
+class node_value_converter;
+
+/// @brief A class to store value of YAML nodes.
+/// @sa https://fktn-k.github.io/fkYAML/api/basic_node/
+template <
+    template <typename, typename...> class SequenceType = std::vector,
+    template <typename, typename, typename...> class MappingType = std::map, typename BooleanType = bool,
+    typename IntegerType = std::int64_t, typename FloatNumberType = double, typename StringType = std::string,
+    template <typename, typename = void> class ConverterType = node_value_converter>
+class basic_node;
+
+/// @brief A reusable YAML parser which keeps its internal buffers across deserializations.
+/// @sa https://fktn-k.github.io/fkYAML/api/parser/
+template <typename BasicNodeType>
+class basic_parser;
+
+/// @brief default YAML node value container.
+/// @sa https://fktn-k.github.io/fkYAML/api/basic_node/node/
+using node = basic_node<>;
+
+/// @brief default reusable YAML parser for the default node type.
+/// @sa https://fktn-k.github.io/fkYAML/api/parser/
+using parser = basic_parser<node>;
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_NODE_FWD_HPP */
@@ -0,0 +1,45 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_NODE_MEMORY_USAGE_HPP
+#define FK_YAML_NODE_MEMORY_USAGE_HPP
+
+#include <cstddef>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A report of the memory footprint of a node tree in bytes by category, returned by memory_usage().
+/// @note Sizes of heap blocks are estimated from the sizes and capacities of objects, and bookkeeping data of memory
+/// allocators are not included.
+/// @sa https://fktn-k.github.io/fkYAML/api/node_memory_usage/
+struct node_memory_usage {
+    /// @brief Get the total bytes of all the categories.
+    /// @return std::size_t The total bytes.
+    std::size_t total() const noexcept {
+        return node_bytes + container_bytes + string_bytes + slack_bytes + metainfo_bytes + anchor_table_bytes;
+    }
+
+    /// The bytes of basic_node objects, i.e., the root node and the elements of sequences and mappings.
+    std::size_t node_bytes {0};
+    /// The bytes of sequence and mapping objects and the tree nodes of mappings if any.
+    std::size_t container_bytes {0};
+    /// The bytes of string objects and their heap-allocated payloads including tags and anchor names.
+    std::size_t string_bytes {0};
+    /// The bytes of unused capacities of sequences and mappings.
+    std::size_t slack_bytes {0};
+    /// The bytes of the document metainfo objects including the input buffers and the key tables they hold.
+    std::size_t metainfo_bytes {0};
+    /// The bytes of the anchor tables including the anchored values.
+    std::size_t anchor_table_bytes {0};
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_NODE_MEMORY_USAGE_HPP */
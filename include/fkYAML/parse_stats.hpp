@@ -0,0 +1,121 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_PARSE_STATS_HPP
+#define FK_YAML_PARSE_STATS_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/node_type.hpp>
+
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief Phases of deserialization whose durations are recorded in parse_stats.
+/// @sa https://fktn-k.github.io/fkYAML/api/parse_stats/
+enum class parse_phase : std::uint32_t {
+    INPUT_NORMALIZATION, //!< encoding detection and conversion, and newline normalization of inputs.
+    LEXING,              //!< lexical analysis of inputs into tokens.
+    SCALAR_CONVERSION,   //!< conversion of scalar tokens into values including unescaping.
+    TREE_BUILDING,       //!< construction of node trees, and anything not included in the other phases.
+    ANCHOR_HANDLING,     //!< registration of anchors and resolution of aliases.
+};
+
+inline const char* to_string(parse_phase p) noexcept {
+    switch (p) {
+    case parse_phase::INPUT_NORMALIZATION:
+        return "INPUT_NORMALIZATION";
+    case parse_phase::LEXING:
+        return "LEXING";
+    case parse_phase::SCALAR_CONVERSION:
+        return "SCALAR_CONVERSION";
+    case parse_phase::TREE_BUILDING:
+        return "TREE_BUILDING";
+    case parse_phase::ANCHOR_HANDLING:
+        return "ANCHOR_HANDLING";
+    default:       // LCOV_EXCL_LINE
+        return ""; // LCOV_EXCL_LINE
+    }
+}
+
+/// @brief Statistics of a deserialization, which are reported to the callback set by set_parse_stats_callback().
+/// @note Statistics are recorded only if the FK_YAML_ENABLE_INSTRUMENTATION macro is defined.
+/// @sa https://fktn-k.github.io/fkYAML/api/parse_stats/
+struct parse_stats {
+    /// @brief Get the duration of the given phase.
+    /// @param phase A parse phase.
+    /// @return std::chrono::nanoseconds The time spent exclusively in the phase.
+    std::chrono::nanoseconds duration(parse_phase phase) const noexcept {
+        return durations[static_cast<std::size_t>(phase)];
+    }
+
+    /// @brief Get the total duration of all the phases.
+    /// @return std::chrono::nanoseconds The time spent in the deserialization.
+    std::chrono::nanoseconds total_duration() const noexcept {
+        std::chrono::nanoseconds total {0};
+        for (const auto& d : durations) {
+            total += d;
+        }
+        return total;
+    }
+
+    /// @brief Get the number of the resulting nodes of the given type.
+    /// @param type A node type.
+    /// @return uint64_t The number of the resulting nodes of the type.
+    uint64_t nodes(node_type type) const noexcept {
+        return num_nodes[static_cast<std::size_t>(type)];
+    }
+
+    /// The time spent exclusively in each phase, indexed by parse_phase values.
+    std::array<std::chrono::nanoseconds, 5> durations {};
+    /// The number of tokens produced by the lexical analyzer.
+    uint64_t num_tokens {0};
+    /// The number of the resulting nodes of each type, indexed by node_type values.
+    std::array<uint64_t, 7> num_nodes {};
+    /// The bytes copied into the internal buffers of input adapters to normalize inputs.
+    uint64_t input_bytes_copied {0};
+    /// The bytes copied into the internal buffer of the scalar parser to unescape or fold scalars.
+    uint64_t scalar_bytes_copied {0};
+    /// The number of unescaped escape sequences.
+    uint64_t num_unescapes {0};
+    /// The number of anchor lookups to resolve aliases.
+    uint64_t num_anchor_lookups {0};
+};
+
+/** A type for callbacks which receive statistics of deserializations. */
+using parse_stats_callback = std::function<void(const parse_stats&)>;
+
+namespace detail {
+
+/// @brief Get the storage of the callback which receives statistics of deserializations.
+/// @return parse_stats_callback& The reference to the callback storage.
+inline parse_stats_callback& parse_stats_callback_storage() noexcept {
+    static parse_stats_callback callback {};
+    return callback;
+}
+
+} // namespace detail
+
+/// @brief Set a callback which receives statistics of each deserialization.
+/// @note The callback is called on the deserializing thread at the end of each deserialization, including failed ones,
+/// only if the FK_YAML_ENABLE_INSTRUMENTATION macro is defined. It must not throw, and must not be replaced while
+/// other threads are deserializing. Passing an empty callback disables reporting.
+/// @param callback A callback which receives statistics of deserializations.
+/// @sa https://fktn-k.github.io/fkYAML/api/parse_stats/set_parse_stats_callback/
+inline void set_parse_stats_callback(parse_stats_callback callback) {
+    detail::parse_stats_callback_storage() = std::move(callback);
+}
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_PARSE_STATS_HPP */
@@ -0,0 +1,116 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_PARSER_HPP
+#define FK_YAML_PARSER_HPP
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <fkYAML/detail/macros/version_macros.hpp>
+#include <fkYAML/detail/input/deserializer.hpp>
+#include <fkYAML/detail/input/input_adapter.hpp>
+#include <fkYAML/detail/input/key_intern_table.hpp>
+#include <fkYAML/detail/meta/node_traits.hpp>
+
+FK_YAML_NAMESPACE_BEGIN
+
+/// @brief A reusable YAML parser which keeps its internal buffers across deserializations.
+/// @note Unlike basic_node::deserialize(), which sets up a new deserializer for each call, this class keeps the
+/// capacity of its internal buffers (e.g., the parse context stack) so that repeatedly deserializing small inputs
+/// doesn't allocate memory other than for the resulting nodes. A parser object must not be used by multiple threads
+/// at the same time.
+/// @tparam BasicNodeType A basic_node template instance type.
+/// @sa https://fktn-k.github.io/fkYAML/api/parser/
+template <typename BasicNodeType>
+class basic_parser {
+    static_assert(detail::is_basic_node<BasicNodeType>::value, "basic_parser only accepts basic_node<...>");
+
+    /** A type for YAML docs deserializers. */
+    using deserializer_type = detail::basic_deserializer<BasicNodeType>;
+
+public:
+    /** A type for the resulting YAML nodes. */
+    using basic_node_type = BasicNodeType;
+    /** A type for tables of mapping key strings shared by YAML documents. */
+    using key_intern_table_type = detail::key_intern_table;
+
+    /// @brief Construct a new basic_parser object.
+    /// @sa https://fktn-k.github.io/fkYAML/api/parser/constructor/
+    basic_parser() = default;
+
+    /// @brief Construct a new basic_parser object which interns mapping keys into the given table.
+    /// @param[in] p_key_table A table to intern mapping key strings into. If null, mapping keys are not interned.
+    /// @sa https://fktn-k.github.io/fkYAML/api/parser/constructor/
+    explicit basic_parser(std::shared_ptr<key_intern_table_type> p_key_table) {
+        m_deserializer.set_key_intern_table(std::move(p_key_table));
+    }
+
+    // the internal buffers are not meant to be shared.
+    basic_parser(const basic_parser&) = delete;
+    basic_parser& operator=(const basic_parser&) = delete;
+
+    basic_parser(basic_parser&&) = default;
+    basic_parser& operator=(basic_parser&&) = default;
+
+    /// @brief Destroy a basic_parser object.
+    ~basic_parser() = default;
+
+    /// @brief Deserialize the first YAML document in the input into a basic_node object.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @return The resulting basic_node object deserialized from the input source.
+    /// @sa https://fktn-k.github.io/fkYAML/api/parser/deserialize/
+    template <typename InputType>
+    basic_node_type deserialize(InputType&& input) {
+        return m_deserializer.deserialize(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Deserialize the first YAML document in the input ranged by the iterators into a basic_node object.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @return The resulting basic_node object deserialized from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/parser/deserialize/
+    template <typename ItrType>
+    basic_node_type deserialize(ItrType&& begin, ItrType&& end) {
+        return m_deserializer.deserialize(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
+    }
+
+    /// @brief Deserialize all YAML documents in the input into basic_node objects.
+    /// @tparam InputType Type of a compatible input.
+    /// @param[in] input An input source in the YAML format.
+    /// @return The resulting basic_node objects deserialized from the input.
+    /// @sa https://fktn-k.github.io/fkYAML/api/parser/deserialize_docs/
+    template <typename InputType>
+    std::vector<basic_node_type> deserialize_docs(InputType&& input) {
+        return m_deserializer.deserialize_docs(detail::input_adapter(std::forward<InputType>(input)));
+    }
+
+    /// @brief Deserialize all YAML documents in the input ranged by the iterators into basic_node objects.
+    /// @tparam ItrType Type of a compatible iterator.
+    /// @param[in] begin An iterator to the first element of an input sequence.
+    /// @param[in] end An iterator to the past-the-last element of an input sequence.
+    /// @return The resulting basic_node objects deserialized from the pair of iterators.
+    /// @sa https://fktn-k.github.io/fkYAML/api/parser/deserialize_docs/
+    template <typename ItrType>
+    std::vector<basic_node_type> deserialize_docs(ItrType&& begin, ItrType&& end) {
+        return m_deserializer.deserialize_docs(
+            detail::input_adapter(std::forward<ItrType>(begin), std::forward<ItrType>(end)));
+    }
+
+private:
+    /// The deserializer whose internal buffers are reused.
+    deserializer_type m_deserializer {};
+};
+
+FK_YAML_NAMESPACE_END
+
+#endif /* FK_YAML_PARSER_HPP */
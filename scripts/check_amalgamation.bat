@@ -7,11 +7,16 @@ set SCRIPT_DIR=%~dp0
 cd $SCRIPT_DIR%\..
 
 set SINGLE_HEADER_PATH=%SCRIPT_DIR%\..\single_include\fkYAML\node.hpp
+set SINGLE_FWD_HEADER_PATH=%SCRIPT_DIR%\..\single_include\fkYAML\node_fwd.hpp
 
 move %SINGLE_HEADER_PATH% %SINGLE_HEADER_PATH%~ > nul
+move %SINGLE_FWD_HEADER_PATH% %SINGLE_FWD_HEADER_PATH%~ > nul
 call %SCRIPT_DIR%\run_amalgamation.bat > nul
 
 fc %SINGLE_HEADER_PATH% %SINGLE_HEADER_PATH%~ > nul
+if %errorlevel% == 0 (
+    fc %SINGLE_FWD_HEADER_PATH% %SINGLE_FWD_HEADER_PATH%~ > nul
+)
 if %errorlevel% == 0 (
     echo Amalgamation check passed!
 ) else (
@@ -20,5 +25,6 @@ if %errorlevel% == 0 (
 )
 
 move %SINGLE_HEADER_PATH%~ %SINGLE_HEADER_PATH% > nul
+move %SINGLE_FWD_HEADER_PATH%~ %SINGLE_FWD_HEADER_PATH% > nul
 
 cd %CALLER_DIR%
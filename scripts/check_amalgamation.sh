@@ -4,15 +4,23 @@ set -eu
 
 ROOT_DIR="$(dirname "$0")/.."
 
-SINGLE_HEADER_PATH="$ROOT_DIR/single_include/fkYAML/node.hpp"
-mv "$SINGLE_HEADER_PATH" "$SINGLE_HEADER_PATH~"
+SINGLE_HEADER_PATHS=("$ROOT_DIR/single_include/fkYAML/node.hpp" "$ROOT_DIR/single_include/fkYAML/node_fwd.hpp")
+for SINGLE_HEADER_PATH in "${SINGLE_HEADER_PATHS[@]}"; do
+    mv "$SINGLE_HEADER_PATH" "$SINGLE_HEADER_PATH~"
+done
 "$ROOT_DIR"/scripts/run_amalgamation.sh >/dev/null
 
-if cmp -s "$SINGLE_HEADER_PATH" "$SINGLE_HEADER_PATH~" ; then
+IS_UP_TO_DATE=true
+for SINGLE_HEADER_PATH in "${SINGLE_HEADER_PATHS[@]}"; do
+    if ! cmp -s "$SINGLE_HEADER_PATH" "$SINGLE_HEADER_PATH~" ; then
+        IS_UP_TO_DATE=false
+    fi
+    mv "$SINGLE_HEADER_PATH~" "$SINGLE_HEADER_PATH"
+done
+
+if [ "$IS_UP_TO_DATE" = true ] ; then
     echo Amalgamation check passed!
 else
     echo Amalgamation required.
     echo Please follow the guideline in the CONTRIBUTING.md file.
 fi
-
-mv "$SINGLE_HEADER_PATH~" "$SINGLE_HEADER_PATH"
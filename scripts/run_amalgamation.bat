@@ -8,6 +8,9 @@ set AMALGAMATION_TOOL_DIR=%SCRIPT_PATH%\..\tool\amalgamation
 cd %SCRIPT_PATH%\..
 
 python %AMALGAMATION_TOOL_DIR%\amalgamate.py -c %AMALGAMATION_TOOL_DIR%\fkYAML.json -s . --verbose=yes
+if %errorlevel% == 0 (
+    python %AMALGAMATION_TOOL_DIR%\amalgamate.py -c %AMALGAMATION_TOOL_DIR%\fkYAML_fwd.json -s . --verbose=yes
+)
 
 if %errorlevel% == 0 (
     echo Amalgamation succeeded!
@@ -15,3 +15,4 @@ fi
 ROOT_DIR="$(dirname "$0")"/..
 AMALGAMATION_TOOL_DIR="$ROOT_DIR/tool/amalgamation"
 "$PYTHON_EXE" "$AMALGAMATION_TOOL_DIR"/amalgamate.py -c "$AMALGAMATION_TOOL_DIR"/fkYAML.json -s . --verbose=yes
+"$PYTHON_EXE" "$AMALGAMATION_TOOL_DIR"/amalgamate.py -c "$AMALGAMATION_TOOL_DIR"/fkYAML_fwd.json -s . --verbose=yes
@@ -0,0 +1,43 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+// The source of the compiled library built with the FK_YAML_BUILD_COMPILED_LIBRARY CMake option.
+// It explicitly instantiates the specializations for the default node type which <fkYAML/node.hpp> declares as extern
+// templates if the FK_YAML_USE_COMPILED_LIBRARY macro is defined. The list must be kept in sync with the header.
+
+#include <string>
+#include <vector>
+
+#include <fkYAML/node.hpp>
+
+FK_YAML_NAMESPACE_BEGIN
+
+template class basic_node<>;
+template class basic_parser<node>;
+
+template node node::deserialize<std::string&>(std::string&);
+template node node::deserialize<const std::string&>(const std::string&);
+template node node::deserialize<const char*>(const char*&&, const char*&&);
+template std::vector<node> node::deserialize_docs<std::string&>(std::string&);
+template std::vector<node> node::deserialize_docs<const std::string&>(const std::string&);
+
+namespace detail {
+
+template class basic_deserializer<node>;
+template class basic_serializer<node>;
+template class basic_json_serializer<node>;
+template class scalar_parser<node>;
+template class json_subset_parser<node>;
+template class tag_resolver<node>;
+template class iterator<node>;
+template class iterator<const node>;
+template class node_memory_counter<node>;
+
+} // namespace detail
+
+FK_YAML_NAMESPACE_END
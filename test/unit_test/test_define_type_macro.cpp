@@ -0,0 +1,151 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace test {
+
+struct point {
+    int x;
+    int y;
+};
+
+FK_YAML_DEFINE_TYPE(point, x, y)
+
+struct book {
+    std::string title;
+    std::string author;
+    int year;
+    double price;
+    bool is_available;
+    fkyaml::node::sequence_type tags;
+    point position;
+};
+
+FK_YAML_DEFINE_TYPE(book, title, author, year, price, is_available, tags, position)
+
+// fields whose names have the same length and the same first character.
+struct similar_names {
+    int abc;
+    int abd;
+    int axc;
+    int ab;
+};
+
+FK_YAML_DEFINE_TYPE(similar_names, abc, abd, axc, ab)
+
+} // namespace test
+
+TEST_CASE("DefineTypeMacro_FromNode") {
+    SECTION("all the fields") {
+        fkyaml::node node = fkyaml::node::deserialize("title: Robinson Crusoe\n"
+                                                      "author: Daniel Defoe\n"
+                                                      "year: 1678\n"
+                                                      "price: 12.5\n"
+                                                      "is_available: true\n"
+                                                      "tags: [adventure, classic]\n"
+                                                      "position: {x: 3, y: -4}\n");
+
+        auto book = node.get_value<test::book>();
+        REQUIRE(book.title == "Robinson Crusoe");
+        REQUIRE(book.author == "Daniel Defoe");
+        REQUIRE(book.year == 1678);
+        REQUIRE(book.price == 12.5);
+        REQUIRE(book.is_available == true);
+        REQUIRE(book.tags.size() == 2);
+        REQUIRE(book.tags[0].get_value<std::string>() == "adventure");
+        REQUIRE(book.tags[1].get_value<std::string>() == "classic");
+        REQUIRE(book.position.x == 3);
+        REQUIRE(book.position.y == -4);
+    }
+
+    SECTION("fields in a different order with unknown keys") {
+        fkyaml::node node = fkyaml::node::deserialize("z: 0\ny: 2\n1: foo\nxx: 1\nx: 1\n");
+
+        auto point = node.get_value<test::point>();
+        REQUIRE(point.x == 1);
+        REQUIRE(point.y == 2);
+    }
+
+    SECTION("fields whose names have the same length and the same first character") {
+        fkyaml::node node = fkyaml::node::deserialize("ab: 4\naxc: 3\nabd: 2\nabc: 1\n");
+
+        auto names = node.get_value<test::similar_names>();
+        REQUIRE(names.abc == 1);
+        REQUIRE(names.abd == 2);
+        REQUIRE(names.axc == 3);
+        REQUIRE(names.ab == 4);
+    }
+
+    SECTION("a sequence of structs") {
+        fkyaml::node node = fkyaml::node::deserialize("- {x: 1, y: 2}\n- {x: 3, y: 4}\n");
+
+        auto points = node.get_value<std::vector<test::point>>();
+        REQUIRE(points.size() == 2);
+        REQUIRE(points[0].x == 1);
+        REQUIRE(points[0].y == 2);
+        REQUIRE(points[1].x == 3);
+        REQUIRE(points[1].y == 4);
+    }
+
+    SECTION("a missing field") {
+        fkyaml::node node = fkyaml::node::deserialize("x: 1\nyy: 2\n");
+        REQUIRE_THROWS_AS(node.get_value<test::point>(), fkyaml::out_of_range);
+    }
+
+    SECTION("a non-mapping node") {
+        fkyaml::node node = fkyaml::node::deserialize("[1, 2]");
+        REQUIRE_THROWS_AS(node.get_value<test::point>(), fkyaml::type_error);
+    }
+
+    SECTION("a field value of a wrong type") {
+        fkyaml::node node = fkyaml::node::deserialize("x: 1\ny: foo\n");
+        REQUIRE_THROWS_AS(node.get_value<test::point>(), fkyaml::type_error);
+    }
+}
+
+TEST_CASE("DefineTypeMacro_ToNode") {
+    test::book book {"Frankenstein", "Mary Shelley", 1818, 9.75, false, {"gothic"}, {5, 6}};
+    fkyaml::node node = book;
+
+    REQUIRE(node.is_mapping());
+    REQUIRE(node.size() == 7);
+    REQUIRE(node["title"].get_value<std::string>() == "Frankenstein");
+    REQUIRE(node["author"].get_value<std::string>() == "Mary Shelley");
+    REQUIRE(node["year"].get_value<int>() == 1818);
+    REQUIRE(node["price"].get_value<double>() == 9.75);
+    REQUIRE(node["is_available"].get_value<bool>() == false);
+    REQUIRE(node["tags"].size() == 1);
+    REQUIRE(node["tags"][0].get_value<std::string>() == "gothic");
+    REQUIRE(node["position"]["x"].get_value<int>() == 5);
+    REQUIRE(node["position"]["y"].get_value<int>() == 6);
+
+    SECTION("round trip") {
+        auto copied = fkyaml::node::deserialize(fkyaml::node::serialize(node)).get_value<test::book>();
+        REQUIRE(copied.title == book.title);
+        REQUIRE(copied.author == book.author);
+        REQUIRE(copied.year == book.year);
+        REQUIRE(copied.price == book.price);
+        REQUIRE(copied.is_available == book.is_available);
+        REQUIRE(copied.tags == book.tags);
+        REQUIRE(copied.position.x == book.position.x);
+        REQUIRE(copied.position.y == book.position.y);
+    }
+
+    SECTION("ordered_map as the mapping type") {
+        fkyaml::basic_node<std::vector, fkyaml::ordered_map> ordered = test::point {7, 8};
+        REQUIRE(fkyaml::basic_node<std::vector, fkyaml::ordered_map>::serialize(ordered) == "x: 7\ny: 8\n");
+        REQUIRE(ordered.get_value<test::point>().y == 8);
+    }
+}
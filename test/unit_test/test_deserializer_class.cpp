@@ -6,6 +6,8 @@
 // SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
 // SPDX-License-Identifier: MIT
 
+#include <functional>
+
 #include <catch2/catch.hpp>
 
 #include <fkYAML/node.hpp>
@@ -332,6 +334,99 @@ TEST_CASE("Deserializer_DuplicateKeys") {
         root = deserializer.deserialize(fkyaml::detail::input_adapter("foo: bar\nfoo: baz")), fkyaml::parse_error);
 }
 
+TEST_CASE("Deserializer_JsonInput") {
+    fkyaml::detail::basic_deserializer<fkyaml::node> deserializer;
+    fkyaml::node root;
+
+    SECTION("inputs in the JSON subset") {
+        auto input = GENERATE(
+            std::string("[]"),
+            std::string("{\"foo\": [1, -2.5, true, null, \"bar\"], \"baz\": {\"qux\": {}}}"),
+            std::string("[\n\t{\"foo\": \"\\u3042\\n\"},\n\t[0, 1e10, -0.0]\n]\n"));
+
+        fkyaml::node expected;
+        REQUIRE_NOTHROW(expected = deserializer.deserialize(fkyaml::detail::input_adapter("# yaml\n" + input)));
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)));
+        REQUIRE(root == expected);
+
+        std::vector<fkyaml::node> docs;
+        REQUIRE_NOTHROW(docs = deserializer.deserialize_docs(fkyaml::detail::input_adapter(input)));
+        REQUIRE(docs.size() == 1);
+        REQUIRE(docs[0] == expected);
+    }
+
+    SECTION("inputs which leave the JSON subset") {
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter("[1, 2,] # comment")));
+        REQUIRE(root.is_sequence());
+        REQUIRE(root.size() == 2);
+
+        std::vector<fkyaml::node> docs;
+        REQUIRE_NOTHROW(docs = deserializer.deserialize_docs(fkyaml::detail::input_adapter("[1]\n---\n{\"foo\": 2}")));
+        REQUIRE(docs.size() == 2);
+        REQUIRE(docs[0].is_sequence());
+        REQUIRE(docs[1].is_mapping());
+    }
+
+    SECTION("errors are reported by the YAML deserializer") {
+        REQUIRE_THROWS_AS(
+            root = deserializer.deserialize(fkyaml::detail::input_adapter("{\"foo\": 1, \"foo\": 2}")),
+            fkyaml::parse_error);
+        REQUIRE_THROWS_AS(
+            root = deserializer.deserialize(fkyaml::detail::input_adapter("[99999999999999999999]")),
+            fkyaml::parse_error);
+    }
+}
+
+TEST_CASE("Deserializer_ParallelDocs") {
+    fkyaml::detail::basic_deserializer<fkyaml::node> deserializer;
+    std::vector<fkyaml::node> expected;
+    std::vector<fkyaml::node> docs;
+
+    // run each task immediately on the calling thread so that the results are deterministic.
+    std::size_t num_tasks = 0;
+    auto inline_executor = [&num_tasks](std::function<void()> task) {
+        ++num_tasks;
+        task();
+    };
+
+    SECTION("inputs with multiple documents") {
+        auto input = GENERATE(
+            std::string("foo: 1\n---\nbar: 2\n...\n--- |\n  ---\n  baz\n---\n[1, 2]\n"),
+            std::string("%YAML 1.2\n--- &anchor foo\n...\n%YAML 1.2\n---\n- bar\n- baz\n...\n"),
+            std::string("- 1\n---\n\"foo\n---\nbar\"\n---\n{foo: [1,\n  2]}\n"));
+
+        REQUIRE_NOTHROW(expected = deserializer.deserialize_docs(fkyaml::detail::input_adapter(input)));
+        REQUIRE_NOTHROW(
+            docs = deserializer.deserialize_docs_parallel(fkyaml::detail::input_adapter(input), inline_executor, 2));
+        REQUIRE(num_tasks == 2);
+        REQUIRE(docs == expected);
+    }
+
+    SECTION("input with a single document") {
+        REQUIRE_NOTHROW(
+            docs = deserializer.deserialize_docs_parallel(
+                fkyaml::detail::input_adapter("foo: bar"), inline_executor, 4));
+        REQUIRE(num_tasks == 0);
+        REQUIRE(docs.size() == 1);
+        REQUIRE(docs[0]["foo"].get_value<std::string>() == "bar");
+    }
+
+    SECTION("errors are reported as in the sequential deserialization") {
+        std::string input = "foo: 1\n---\n[1,\n---\n2]\n---\nbar";
+        REQUIRE_THROWS_AS(
+            docs = deserializer.deserialize_docs_parallel(fkyaml::detail::input_adapter(input), inline_executor, 4),
+            fkyaml::parse_error);
+    }
+
+    SECTION("failure in submitting a task") {
+        auto failing_executor = [](std::function<void()>) { throw fkyaml::exception("cannot run a task."); };
+        REQUIRE_THROWS_AS(
+            docs = deserializer.deserialize_docs_parallel(
+                fkyaml::detail::input_adapter("foo\n---\nbar"), failing_executor, 2),
+            fkyaml::exception);
+    }
+}
+
 TEST_CASE("Deserializer_BlockSequence") {
     fkyaml::detail::basic_deserializer<fkyaml::node> deserializer;
     fkyaml::node root;
@@ -1717,6 +1812,24 @@ TEST_CASE("Deserializer_FlowSequence") {
         REQUIRE(foo_node.is_sequence());
         REQUIRE(foo_node.empty());
     }
+
+    SECTION("flow sequences reserved for their entries") {
+        std::string input = "foo: [1, [2, 3], {a: [4, 5, 6]}, 'x, y']\nbar: [[7]]\n";
+        REQUIRE_NOTHROW(root = deserializer.deserialize(fkyaml::detail::input_adapter(input)));
+
+        using seq_t = fkyaml::node::sequence_type;
+        fkyaml::node& foo_node = root["foo"];
+        REQUIRE(foo_node.size() == 4);
+        REQUIRE(foo_node.get_value_ref<seq_t&>().capacity() == 4);
+        REQUIRE(foo_node[1].get_value_ref<seq_t&>().capacity() == 2);
+        REQUIRE(foo_node[2]["a"].get_value_ref<seq_t&>().capacity() == 3);
+        REQUIRE(foo_node[3].get_value<std::string>() == "x, y");
+
+        fkyaml::node& bar_node = root["bar"];
+        REQUIRE(bar_node.get_value_ref<seq_t&>().capacity() == 1);
+        REQUIRE(bar_node[0].get_value_ref<seq_t&>().capacity() == 1);
+        REQUIRE(bar_node[0][0].get_value<int>() == 7);
+    }
 }
 
 TEST_CASE("Deserializer_FlowMapping") {
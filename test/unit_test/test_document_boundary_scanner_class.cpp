@@ -0,0 +1,106 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+static std::vector<std::string> split(const char* input) {
+    std::vector<std::string> parts {};
+    for (auto part : fkyaml::detail::document_boundary_scanner::split(input)) {
+        parts.emplace_back(part.begin(), part.end());
+    }
+    return parts;
+}
+
+TEST_CASE("DocumentBoundaryScanner_SingleDocument") {
+    REQUIRE(split("") == std::vector<std::string> {""});
+    REQUIRE(split("foo: bar\n") == std::vector<std::string> {"foo: bar\n"});
+    REQUIRE(split("---\nfoo: bar\n") == std::vector<std::string> {"---\nfoo: bar\n"});
+    REQUIRE(split("%YAML 1.2\n---\nfoo: bar\n") == std::vector<std::string> {"%YAML 1.2\n---\nfoo: bar\n"});
+    REQUIRE(split("# comment\n---\nfoo\n") == std::vector<std::string> {"# comment\n---\nfoo\n"});
+}
+
+TEST_CASE("DocumentBoundaryScanner_DirectivesEndMarker") {
+    SECTION("marker lines after contents") {
+        REQUIRE(split("foo\n---\nbar\n---\nbaz") == std::vector<std::string> {"foo\n", "---\nbar\n", "---\nbaz"});
+    }
+
+    SECTION("marker line with contents") {
+        REQUIRE(split("--- foo\n--- bar\n") == std::vector<std::string> {"--- foo\n", "--- bar\n"});
+    }
+
+    SECTION("consecutive marker lines") {
+        REQUIRE(split("---\n---\nfoo\n---\nbar") == std::vector<std::string> {"---\n---\nfoo\n", "---\nbar"});
+    }
+
+    SECTION("directives belong to the next document") {
+        REQUIRE(
+            split("foo\n...\n%YAML 1.2\n---\nbar\n") == std::vector<std::string> {"foo\n", "%YAML 1.2\n---\nbar\n"});
+    }
+
+    SECTION("not a marker") {
+        REQUIRE(split("foo\n---bar\n ---\n") == std::vector<std::string> {"foo\n---bar\n ---\n"});
+    }
+}
+
+TEST_CASE("DocumentBoundaryScanner_DocumentEndMarker") {
+    SECTION("marker lines are excluded") {
+        REQUIRE(split("foo\n...\nbar\n...\n") == std::vector<std::string> {"foo\n", "bar\n", ""});
+    }
+
+    SECTION("marker line followed by contents") {
+        REQUIRE(split("foo\n... bar\n") == std::vector<std::string> {"foo\n... bar\n"});
+    }
+
+    SECTION("marker line followed by a comment") {
+        REQUIRE(split("foo\n... # comment\nbar") == std::vector<std::string> {"foo\n", "bar"});
+    }
+}
+
+TEST_CASE("DocumentBoundaryScanner_BlockScalar") {
+    SECTION("markers in block scalar contents") {
+        auto input = "foo: |\n  ---\n  ...\n---\nbar: >-\n  ---\n";
+        REQUIRE(split(input) == std::vector<std::string> {"foo: |\n  ---\n  ...\n", "---\nbar: >-\n  ---\n"});
+    }
+
+    SECTION("block scalar with an indentation indicator") {
+        auto input = "--- |2\n  ---\n---\nfoo";
+        REQUIRE(split(input) == std::vector<std::string> {"--- |2\n  ---\n", "---\nfoo"});
+    }
+
+    SECTION("block scalar as a block sequence entry") {
+        auto input = "- |+ # comment\n  ---\n---\nfoo";
+        REQUIRE(split(input) == std::vector<std::string> {"- |+ # comment\n  ---\n", "---\nfoo"});
+    }
+
+    SECTION("not a block scalar header") {
+        auto input = "foo: bar |\n---\nbaz";
+        REQUIRE(split(input) == std::vector<std::string> {"foo: bar |\n", "---\nbaz"});
+    }
+}
+
+TEST_CASE("DocumentBoundaryScanner_FlowContextAndQuotedScalar") {
+    SECTION("markers in a flow collection") {
+        auto input = "[1,\n---\n2]\n---\n{foo: [bar,\n...\n]}";
+        REQUIRE(split(input) == std::vector<std::string> {"[1,\n---\n2]\n", "---\n{foo: [bar,\n...\n]}"});
+    }
+
+    SECTION("markers in a quoted scalar") {
+        auto input = "\"foo\\\"\n---\n\"\n---\n'bar''\n...\n'";
+        REQUIRE(split(input) == std::vector<std::string> {"\"foo\\\"\n---\n\"\n", "---\n'bar''\n...\n'"});
+    }
+
+    SECTION("flow indicators in plain scalars and comments") {
+        auto input = "foo: b[a]r\nbaz: it's # [\n---\nqux";
+        REQUIRE(split(input) == std::vector<std::string> {"foo: b[a]r\nbaz: it's # [\n", "---\nqux"});
+    }
+}
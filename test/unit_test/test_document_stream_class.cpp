@@ -0,0 +1,121 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+template <typename InputAdapterType>
+static std::vector<fkyaml::node> read_all(InputAdapterType&& input_adapter) {
+    fkyaml::detail::basic_document_stream<fkyaml::node, InputAdapterType> stream(std::move(input_adapter));
+    std::vector<fkyaml::node> docs;
+    for (auto& doc : stream) {
+        docs.emplace_back(std::move(doc));
+    }
+    return docs;
+}
+
+TEST_CASE("DocumentStream_SameResultsAsDeserializeDocs") {
+    auto input = GENERATE(
+        std::string(""),
+        std::string("foo"),
+        std::string("foo\n...\n"),
+        std::string("foo: 1\n---\nbar: 2\n...\n--- |\n  ---\n  baz\n---\n[1,\n  2]\n"),
+        std::string("%YAML 1.2\n---\nfoo\n...\n%YAML 1.2\n---\n&anchor bar: *anchor\n"),
+        std::string("--- foo\n--- bar\n---\n---\n"),
+        std::string("{\"foo\": 1}\n---\n[\"bar\"]\n"),
+        std::string("foo\r\n---\r\nbar\r\n"));
+
+    std::vector<fkyaml::node> expected = fkyaml::node::deserialize_docs(input);
+
+    SECTION("std::string") {
+        REQUIRE(read_all(fkyaml::detail::input_adapter(input)) == expected);
+    }
+
+    SECTION("std::istream") {
+        std::istringstream iss(input);
+        REQUIRE(read_all(fkyaml::detail::input_adapter(iss)) == expected);
+    }
+
+    SECTION("FILE pointer") {
+        FILE* p_file = std::tmpfile();
+        REQUIRE(p_file != nullptr);
+        std::fwrite(input.data(), sizeof(char), input.size(), p_file);
+        std::rewind(p_file);
+        REQUIRE(read_all(fkyaml::detail::input_adapter(p_file)) == expected);
+        std::fclose(p_file);
+    }
+
+    SECTION("UTF-16 encoded input") {
+        std::u16string u16_input(input.begin(), input.end());
+        REQUIRE(read_all(fkyaml::detail::input_adapter(u16_input)) == expected);
+    }
+}
+
+TEST_CASE("DocumentStream_IncrementalRead") {
+    // the last document is large enough not to be read together with the first one.
+    std::string input = "foo: 1\n---\nbar: 2\n---\nbaz: 3\n";
+    input += "---\nqux: " + std::string(10000, 'x') + "\n";
+    std::istringstream iss(input);
+    fkyaml::detail::basic_document_stream<fkyaml::node, fkyaml::detail::stream_input_adapter> stream(
+        fkyaml::detail::input_adapter(iss));
+
+    auto itr = stream.begin();
+    REQUIRE(itr != stream.end());
+    REQUIRE((*itr)["foo"].get_value<int>() == 1);
+    // the input stream is read chunk by chunk just as far as needed to find the beginning of the next document.
+    REQUIRE(iss.tellg() != std::streampos(-1));
+    REQUIRE(iss.tellg() < std::streampos(input.size()));
+
+    ++itr;
+    REQUIRE(itr != stream.end());
+    REQUIRE(itr->contains("bar"));
+    REQUIRE(stream.begin() == itr);
+
+    ++itr;
+    REQUIRE((*itr)["baz"].get_value<int>() == 3);
+
+    ++itr;
+    REQUIRE((*itr)["qux"].get_value_ref<std::string&>().size() == 10000);
+
+    ++itr;
+    REQUIRE(itr == stream.end());
+    REQUIRE(stream.begin() == stream.end());
+}
+
+TEST_CASE("DocumentStream_Errors") {
+    auto input = std::string("foo: 1\n---\nbar: 2\n...\nbaz: [1]]\n");
+
+    std::string expected_msg;
+    try {
+        fkyaml::node::deserialize_docs(input);
+    }
+    catch (const fkyaml::parse_error& e) {
+        expected_msg = e.what();
+    }
+    REQUIRE_FALSE(expected_msg.empty());
+
+    // errors are reported at the same positions as in the whole input.
+    std::istringstream iss(input);
+    fkyaml::detail::basic_document_stream<fkyaml::node, fkyaml::detail::stream_input_adapter> stream(
+        fkyaml::detail::input_adapter(iss));
+    auto itr = stream.begin();
+    ++itr;
+    try {
+        ++itr;
+        FAIL("parse_error is not thrown.");
+    }
+    catch (const fkyaml::parse_error& e) {
+        REQUIRE(std::string(e.what()) == expected_msg);
+    }
+}
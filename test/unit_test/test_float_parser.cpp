@@ -0,0 +1,183 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace {
+
+uint64_t to_bits(double value) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+uint32_t to_bits(float value) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+} // namespace
+
+TEST_CASE("FloatParser_ParseFloat_Double") {
+    double value = 0.;
+
+    SECTION("values in the fast path") {
+        using test_data_t = std::pair<std::string, double>;
+        auto test_data = GENERATE(
+            test_data_t("0", 0.),
+            test_data_t("3.14", 3.14),
+            test_data_t("-0.5", -0.5),
+            test_data_t(".25", .25),
+            test_data_t("1.", 1.),
+            test_data_t("1e22", 1e22),
+            test_data_t("123.456E-7", 123.456E-7),
+            test_data_t("9007199254740992", 9007199254740992.));
+
+        std::string& input = test_data.first;
+        REQUIRE(fkyaml::detail::parse_float(input.data(), input.data() + input.size(), value));
+        REQUIRE(to_bits(value) == to_bits(test_data.second));
+    }
+
+    SECTION("values in the Eisel-Lemire path") {
+        using test_data_t = std::pair<std::string, uint64_t>;
+        auto test_data = GENERATE(
+            test_data_t("9007199254740993", UINT64_C(0x4340000000000000)),
+            test_data_t("9007199254740995", UINT64_C(0x4340000000000002)),
+            test_data_t("1e23", UINT64_C(0x44B52D02C7E14AF6)),
+            test_data_t("1.7976931348623157e308", UINT64_C(0x7FEFFFFFFFFFFFFF)),
+            test_data_t("2.2250738585072014e-308", UINT64_C(0x0010000000000000)),
+            test_data_t("2.2250738585072011e-308", UINT64_C(0x000FFFFFFFFFFFFF)),
+            test_data_t("4.9406564584124654e-324", UINT64_C(0x0000000000000001)),
+            test_data_t("-1e-300", UINT64_C(0x81A56E1FC2F8F359)));
+
+        std::string& input = test_data.first;
+        REQUIRE(fkyaml::detail::parse_float(input.data(), input.data() + input.size(), value));
+        REQUIRE(to_bits(value) == test_data.second);
+    }
+
+    SECTION("values with more than 19 significant digits") {
+        // the exact halfway point between 9007199254740992 and 9007199254740994 is rounded to even.
+        std::string tie = "9007199254740993.000000000000000000000";
+        REQUIRE(fkyaml::detail::parse_float(tie.data(), tie.data() + tie.size(), value));
+        REQUIRE(to_bits(value) == UINT64_C(0x4340000000000000));
+
+        // any digit after the halfway point makes the value round up.
+        std::string above_tie = "9007199254740993.000000000000000000001";
+        REQUIRE(fkyaml::detail::parse_float(above_tie.data(), above_tie.data() + above_tie.size(), value));
+        REQUIRE(to_bits(value) == UINT64_C(0x4340000000000001));
+
+        // the same as above but the last digit is beyond the 800th significant digit.
+        std::string far_above_tie = "9007199254740993." + std::string(1000, '0') + "1";
+        REQUIRE(fkyaml::detail::parse_float(far_above_tie.data(), far_above_tie.data() + far_above_tie.size(), value));
+        REQUIRE(to_bits(value) == UINT64_C(0x4340000000000001));
+
+        // the halfway point between the largest subnormal value and the smallest normal value is rounded to even.
+        std::string subnormal_tie = "2.225073858507201136057409796709131975934819546351645648023426109724822222021076"
+                                    "94551652952390813508791414915891303962110687008643869459464552765720740782062174"
+                                    "33799881410632673292535522868813721490129811224514518898490572223072852551331557"
+                                    "55015914397476397983411801999323962548289017107081850690630666655994938275772572"
+                                    "01576306269066333264756530000924588831643303777979186961204949739037782970490505"
+                                    "10806099407302629371289589500035837999672072543043602840788957717961509455167482"
+                                    "43471030702609144621572289880258182545180325707018860872113128079512233426288368"
+                                    "62232150377566662250398253433597456888442390026549819838548794829220689472168983"
+                                    "10996983658468140228542433306603398508864458040010349339704275671864433837704860"
+                                    "3786162277173854562306587467901408672332763671875e-308";
+        REQUIRE(fkyaml::detail::parse_float(subnormal_tie.data(), subnormal_tie.data() + subnormal_tie.size(), value));
+        REQUIRE(to_bits(value) == UINT64_C(0x0010000000000000));
+
+        // the same as above but slightly below the halfway point.
+        subnormal_tie.replace(subnormal_tie.size() - 6, 1, "4999");
+        REQUIRE(fkyaml::detail::parse_float(subnormal_tie.data(), subnormal_tie.data() + subnormal_tie.size(), value));
+        REQUIRE(to_bits(value) == UINT64_C(0x000FFFFFFFFFFFFF));
+
+        std::string long_integer = "123456789012345678901234567890";
+        REQUIRE(fkyaml::detail::parse_float(long_integer.data(), long_integer.data() + long_integer.size(), value));
+        REQUIRE(value == 123456789012345678901234567890.);
+    }
+
+    SECTION("infinities and NaNs") {
+        auto input = GENERATE(std::string("inf"), std::string("INF"), std::string("Infinity"), std::string("-inf"));
+        REQUIRE(fkyaml::detail::parse_float(input.data(), input.data() + input.size(), value));
+        REQUIRE(std::isinf(value));
+
+        auto nan_input = GENERATE(std::string("nan"), std::string("NaN"), std::string("-nan"), std::string("nan(0x1)"));
+        REQUIRE(fkyaml::detail::parse_float(nan_input.data(), nan_input.data() + nan_input.size(), value));
+        REQUIRE(std::isnan(value));
+    }
+
+    SECTION("out of range values") {
+        auto input = GENERATE(
+            std::string("1e309"),
+            std::string("-1.7976931348623159e308"),
+            std::string("1e-400"),
+            std::string("2.4703282292062327e-324"),
+            std::string("1e99999999999999"));
+        REQUIRE_FALSE(fkyaml::detail::parse_float(input.data(), input.data() + input.size(), value));
+    }
+
+    SECTION("zeros with large exponents") {
+        auto input = GENERATE(std::string("0e999"), std::string("-0.000e-999"));
+        REQUIRE(fkyaml::detail::parse_float(input.data(), input.data() + input.size(), value));
+        REQUIRE(value == 0.);
+    }
+
+    SECTION("invalid forms") {
+        auto input = GENERATE(
+            std::string(""),
+            std::string("-"),
+            std::string("+1.5"),
+            std::string("."),
+            std::string("-."),
+            std::string("e5"),
+            std::string("1e"),
+            std::string("1e+"),
+            std::string("1.5.2"),
+            std::string(" 1.5"),
+            std::string("1.5 "),
+            std::string("0x1p3"),
+            std::string("infinit"),
+            std::string("nan("),
+            std::string("nan(-)"));
+        REQUIRE_FALSE(fkyaml::detail::parse_float(input.data(), input.data() + input.size(), value));
+    }
+}
+
+TEST_CASE("FloatParser_ParseFloat_Float") {
+    float value = 0.f;
+
+    SECTION("valid values") {
+        using test_data_t = std::pair<std::string, uint32_t>;
+        auto test_data = GENERATE(
+            test_data_t("3.14", UINT32_C(0x4048F5C3)),
+            test_data_t("16777217", UINT32_C(0x4B800000)),
+            test_data_t("16777219", UINT32_C(0x4B800002)),
+            test_data_t("3.4028234663852886e38", UINT32_C(0x7F7FFFFF)),
+            test_data_t("1.17549435e-38", UINT32_C(0x00800000)),
+            test_data_t("1.4e-45", UINT32_C(0x00000001)),
+            test_data_t("16777217.00000000000000000001", UINT32_C(0x4B800001)));
+
+        std::string& input = test_data.first;
+        REQUIRE(fkyaml::detail::parse_float(input.data(), input.data() + input.size(), value));
+        REQUIRE(to_bits(value) == test_data.second);
+    }
+
+    SECTION("out of range values") {
+        auto input = GENERATE(std::string("3.40282357e38"), std::string("1e-46"));
+        REQUIRE_FALSE(fkyaml::detail::parse_float(input.data(), input.data() + input.size(), value));
+    }
+}
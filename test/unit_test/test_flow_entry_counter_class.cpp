@@ -0,0 +1,80 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+// counts entries of the flow collection which begins with the first character of the input.
+static std::vector<uint32_t> count_entries(const std::string& input, std::size_t num_collections) {
+    fkyaml::detail::flow_entry_counter counter {};
+    counter.count(fkyaml::detail::str_view(input).substr(1));
+
+    std::vector<uint32_t> counts {};
+    for (std::size_t i = 0; i < num_collections; i++) {
+        counts.emplace_back(counter.next());
+    }
+    return counts;
+}
+
+TEST_CASE("FlowEntryCounter_Count") {
+    using counts_t = std::vector<uint32_t>;
+
+    SECTION("flow sequences") {
+        REQUIRE(count_entries("[]", 1) == counts_t {0});
+        REQUIRE(count_entries("[ ]", 1) == counts_t {0});
+        REQUIRE(count_entries("[foo]", 1) == counts_t {1});
+        REQUIRE(count_entries("[1, 2, 3]", 1) == counts_t {3});
+        REQUIRE(count_entries("[1, 2, 3,]", 1) == counts_t {3});
+        REQUIRE(count_entries("[\n  1,\n  2\n]", 1) == counts_t {2});
+    }
+
+    SECTION("flow mappings") {
+        REQUIRE(count_entries("{}", 1) == counts_t {0});
+        REQUIRE(count_entries("{foo: bar}", 1) == counts_t {1});
+        REQUIRE(count_entries("{\"foo\":\"bar\",\"baz\":123}", 1) == counts_t {2});
+        REQUIRE(count_entries("{foo, bar: baz}", 1) == counts_t {2});
+    }
+
+    SECTION("nested flow collections in order of their beginnings") {
+        REQUIRE(count_entries("[[1, 2], {a: b}, [], 3]", 4) == (counts_t {4, 2, 1, 0}));
+        REQUIRE(count_entries("{a: [1, [2, 3]], b: {c: d}}", 4) == (counts_t {2, 2, 2, 1}));
+    }
+
+    SECTION("flow indicators in scalars and comments") {
+        REQUIRE(count_entries("['a, b', \"c]d\", 'e''f,']", 1) == counts_t {3});
+        REQUIRE(count_entries("[\"a\\\", b\", c]", 1) == counts_t {2});
+        REQUIRE(count_entries("[a # b, c]\n, d]", 1) == counts_t {2});
+        REQUIRE(count_entries("[a#b, c'd, e]", 1) == counts_t {3});
+    }
+
+    SECTION("the outermost flow collection ends") {
+        REQUIRE(count_entries("[1, 2] [3, 4]", 2) == (counts_t {2, 0}));
+    }
+
+    SECTION("an unterminated flow collection") {
+        REQUIRE(count_entries("[1, 2, 3", 1) == counts_t {2});
+        REQUIRE(count_entries("[1, 'foo", 1) == counts_t {1});
+    }
+
+    SECTION("the counts are replaced") {
+        fkyaml::detail::flow_entry_counter counter {};
+        std::string input = "1, [2]]";
+        counter.count(fkyaml::detail::str_view(input));
+        REQUIRE(counter.next() == 2);
+
+        input = "3, 4, 5]";
+        counter.count(fkyaml::detail::str_view(input));
+        REQUIRE(counter.next() == 3);
+        REQUIRE(counter.next() == 0);
+    }
+}
@@ -6,9 +6,13 @@
 // SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
 // SPDX-License-Identifier: MIT
 
+#include <algorithm>
 #include <cstdio>
 #include <fstream>
+#include <sstream>
+#include <streambuf>
 #include <string>
+#include <vector>
 
 #include <catch2/catch.hpp>
 
@@ -166,6 +170,41 @@ TEST_CASE("InputAdapter_StreamInputAdapterProvider") {
     }
 }
 
+TEST_CASE("InputAdapter_RefersToInput") {
+    SECTION("UTF-8 contiguous inputs without CRs") {
+        std::string input = "foo: bar\n";
+        auto input_adapter = fkyaml::detail::input_adapter(input);
+        fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
+        REQUIRE(buffer.data() == input.data());
+        REQUIRE(input_adapter.refers_to_input());
+    }
+
+    SECTION("UTF-8 contiguous inputs with CRs") {
+        std::string input = "foo: bar\r\n";
+        auto input_adapter = fkyaml::detail::input_adapter(input);
+        fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
+        REQUIRE(buffer == "foo: bar\n");
+        REQUIRE_FALSE(input_adapter.refers_to_input());
+    }
+
+    SECTION("UTF-16 inputs") {
+        char16_t input[] = u"foo";
+        auto input_adapter = fkyaml::detail::input_adapter(input);
+        fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
+        REQUIRE(buffer == "foo");
+        REQUIRE_FALSE(input_adapter.refers_to_input());
+    }
+
+    SECTION("stream inputs") {
+        std::stringstream ss;
+        ss << "foo";
+        auto input_adapter = fkyaml::detail::input_adapter(ss);
+        fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
+        REQUIRE(buffer == "foo");
+        REQUIRE_FALSE(input_adapter.refers_to_input());
+    }
+}
+
 TEST_CASE("InputAdapter_FillBuffer_UTF8N") {
     SECTION("iterator_input_adapter with a char array") {
         char input[] = "test source.";
@@ -1949,3 +1988,255 @@ TEST_CASE("InputAdapter_FillBuffer_UTF32BENewlineCodeNormalization") {
         REQUIRE(buffer[9] == '\n');
     }
 }
+
+namespace {
+
+// Reads the lines of (long_line + "\nfoo\0bar\n\nbaz") one by one.
+template <typename InputAdapterType>
+void check_long_lines_with_null(InputAdapterType& input_adapter, const std::string& long_line) {
+    std::string line;
+    REQUIRE(input_adapter.read_line(line));
+    REQUIRE(line == long_line + "\n");
+    line.clear();
+    REQUIRE(input_adapter.read_line(line));
+    REQUIRE(line == "foo" + std::string(1, '\0') + "bar\n");
+    line.clear();
+    REQUIRE(input_adapter.read_line(line));
+    REQUIRE(line == "\n");
+    line.clear();
+    REQUIRE(input_adapter.read_line(line));
+    REQUIRE(line == "baz");
+    line.clear();
+    REQUIRE_FALSE(input_adapter.read_line(line));
+}
+
+// Reads the lines of ("foo\n" + tail) one by one, where tail doesn't end with a newline code.
+template <typename InputAdapterType>
+void check_unterminated_tail(InputAdapterType& input_adapter, const std::string& tail) {
+    std::string line;
+    REQUIRE(input_adapter.read_line(line));
+    REQUIRE(line == "foo\n");
+    line.clear();
+    REQUIRE(input_adapter.read_line(line));
+    REQUIRE(line == tail);
+    line.clear();
+    REQUIRE_FALSE(input_adapter.read_line(line));
+}
+
+} // namespace
+
+TEST_CASE("InputAdapter_ReadLine_UTF8") {
+    SECTION("file_input_adapter") {
+        DISABLE_C4996
+        FILE* p_file = std::fopen(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data_utf8_crlf.txt", "r");
+        ENABLE_C4996
+
+        auto input_adapter = fkyaml::detail::input_adapter(p_file);
+        REQUIRE(input_adapter.get_encode_type() == fkyaml::detail::utf_encode_t::UTF_8);
+
+        std::string line;
+        REQUIRE(input_adapter.read_line(line));
+        REQUIRE(line == "test\n");
+        REQUIRE(input_adapter.read_line(line));
+        REQUIRE(line == "test\ndata\n");
+        line.clear();
+        REQUIRE_FALSE(input_adapter.read_line(line));
+        REQUIRE(line.empty());
+
+        std::fclose(p_file);
+    }
+
+    SECTION("stream_input_adapter") {
+        std::ifstream ifs(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data_utf8_crlf.txt");
+        auto input_adapter = fkyaml::detail::input_adapter(ifs);
+        REQUIRE(input_adapter.get_encode_type() == fkyaml::detail::utf_encode_t::UTF_8);
+
+        std::string line;
+        REQUIRE(input_adapter.read_line(line));
+        REQUIRE(line == "test\n");
+        line.clear();
+        REQUIRE(input_adapter.read_line(line));
+        REQUIRE(line == "data\n");
+        line.clear();
+        REQUIRE_FALSE(input_adapter.read_line(line));
+        REQUIRE(line.empty());
+    }
+
+    SECTION("the last line without a newline code") {
+        std::istringstream iss("foo\nbar");
+        auto input_adapter = fkyaml::detail::input_adapter(iss);
+
+        std::string line;
+        REQUIRE(input_adapter.read_line(line));
+        REQUIRE(line == "foo\n");
+        line.clear();
+        REQUIRE(input_adapter.read_line(line));
+        REQUIRE(line == "bar");
+        line.clear();
+        REQUIRE_FALSE(input_adapter.read_line(line));
+    }
+
+    SECTION("long lines and null characters") {
+        std::string long_line(GENERATE(4094, 4095, 4096, 10000), 'a');
+        std::string input = long_line + "\nfoo" + std::string(1, '\0') + "bar\n\nbaz";
+
+        DISABLE_C4996
+        FILE* p_file = std::tmpfile();
+        ENABLE_C4996
+        REQUIRE(p_file != nullptr);
+        std::fwrite(input.data(), sizeof(char), input.size(), p_file);
+        std::rewind(p_file);
+        auto file_input_adapter = fkyaml::detail::input_adapter(p_file);
+        check_long_lines_with_null(file_input_adapter, long_line);
+        std::fclose(p_file);
+
+        std::istringstream iss(input);
+        auto stream_input_adapter = fkyaml::detail::input_adapter(iss);
+        check_long_lines_with_null(stream_input_adapter, long_line);
+    }
+
+    SECTION("unterminated last lines around the chunk size") {
+        auto tail = GENERATE(
+            std::string(4093, 'a'),
+            std::string(4094, 'a'),
+            std::string(4095, 'a'),
+            std::string(4093, 'a') + std::string(1, '\0'),
+            std::string("foo") + std::string(1, '\0') + "bar");
+        std::string input = "foo\n" + tail;
+
+        DISABLE_C4996
+        FILE* p_file = std::tmpfile();
+        ENABLE_C4996
+        REQUIRE(p_file != nullptr);
+        std::fwrite(input.data(), sizeof(char), input.size(), p_file);
+        std::rewind(p_file);
+        auto file_input_adapter = fkyaml::detail::input_adapter(p_file);
+        check_unterminated_tail(file_input_adapter, tail);
+        std::fclose(p_file);
+
+        std::istringstream iss(input);
+        auto stream_input_adapter = fkyaml::detail::input_adapter(iss);
+        check_unterminated_tail(stream_input_adapter, tail);
+    }
+
+    SECTION("invalid UTF-8 characters") {
+        auto input = GENERATE(
+            std::string("a\xC2\n"), std::string("a\xE3\x81\n"), std::string("a\xF0\xA0\x80\n"), std::string("\x80\n"),
+            std::string("\xE3\x28\x82\n"));
+        std::istringstream iss(input);
+        auto input_adapter = fkyaml::detail::input_adapter(iss);
+
+        std::string line;
+        REQUIRE_THROWS_AS(input_adapter.read_line(line), fkyaml::invalid_encoding);
+    }
+}
+
+namespace {
+
+// A stream buffer which provides at most 3 characters at a time and supports no seek operation like pipes.
+class non_seekable_buf : public std::streambuf {
+public:
+    explicit non_seekable_buf(std::string data)
+        : m_data(std::move(data)) {
+    }
+
+    // The number of characters which have been provided to the stream so far.
+    std::size_t provided() const {
+        return m_pos;
+    }
+
+protected:
+    int_type underflow() override {
+        if (m_pos >= m_data.size()) {
+            return traits_type::eof();
+        }
+        std::size_t n = std::min<std::size_t>(3, m_data.size() - m_pos);
+        char* p_begin = &m_data[m_pos];
+        setg(p_begin, p_begin, p_begin + n);
+        m_pos += n;
+        return traits_type::to_int_type(*p_begin);
+    }
+
+private:
+    std::string m_data;
+    std::size_t m_pos {0};
+};
+
+} // namespace
+
+TEST_CASE("InputAdapter_NonSeekableStream") {
+    SECTION("UTF-8(BOM) input with lines across chunk boundaries") {
+        std::string long_line(5000, 'a');
+        non_seekable_buf buf("\xEF\xBB\xBF" + long_line + "\r\nfoo\n" + long_line);
+        std::istream is(&buf);
+        auto input_adapter = fkyaml::detail::input_adapter(is);
+        REQUIRE(input_adapter.get_encode_type() == fkyaml::detail::utf_encode_t::UTF_8);
+
+        std::string line;
+        REQUIRE(input_adapter.read_line(line));
+        REQUIRE(line == long_line + "\n");
+        line.clear();
+        REQUIRE(input_adapter.read_line(line));
+        REQUIRE(line == "foo\n");
+        line.clear();
+        REQUIRE(input_adapter.read_line(line));
+        REQUIRE(line == long_line);
+        line.clear();
+        REQUIRE_FALSE(input_adapter.read_line(line));
+    }
+
+    SECTION("lines are read without waiting for the following input") {
+        non_seekable_buf buf("foo: bar\n---\n" + std::string(10000, 'a'));
+        std::istream is(&buf);
+        auto input_adapter = fkyaml::detail::input_adapter(is);
+
+        std::string line;
+        REQUIRE(input_adapter.read_line(line));
+        REQUIRE(line == "foo: bar\n");
+        line.clear();
+        REQUIRE(input_adapter.read_line(line));
+        REQUIRE(line == "---\n");
+        // at most one more chunk of the stream buffer may have been provided after the second line.
+        REQUIRE(buf.provided() <= std::string("foo: bar\n---\n").size() + 3);
+    }
+
+    SECTION("UTF-8 input read at once") {
+        std::string input = "foo: bar\r\n" + std::string(5000, 'b');
+        non_seekable_buf buf(input);
+        std::istream is(&buf);
+        auto input_adapter = fkyaml::detail::input_adapter(is);
+
+        fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
+        REQUIRE(buffer.size() == input.size() - 1);
+        REQUIRE(buffer.starts_with("foo: bar\nbbb"));
+    }
+
+    SECTION("UTF-16BE(BOM) input") {
+        non_seekable_buf buf(std::string {char(0xFEu), char(0xFFu), 0, 0x61, 0x30, 0x42, 0, 0x0A, 0, 0x62});
+        std::istream is(&buf);
+        auto input_adapter = fkyaml::detail::input_adapter(is);
+        REQUIRE(input_adapter.get_encode_type() == fkyaml::detail::utf_encode_t::UTF_16BE);
+
+        fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
+        REQUIRE(buffer == "a\xE3\x81\x82\nb");
+    }
+
+    SECTION("UTF-32LE input") {
+        non_seekable_buf buf(std::string {0x61, 0, 0, 0, 0x0A, 0, 0, 0, 0x62, 0, 0, 0});
+        std::istream is(&buf);
+        auto input_adapter = fkyaml::detail::input_adapter(is);
+        REQUIRE(input_adapter.get_encode_type() == fkyaml::detail::utf_encode_t::UTF_32LE);
+
+        fkyaml::detail::str_view buffer = input_adapter.get_buffer_view();
+        REQUIRE(buffer == "a\nb");
+    }
+
+    SECTION("deserialize documents") {
+        non_seekable_buf buf("foo: 1\n---\nbar: 2\n");
+        std::istream is(&buf);
+        std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs(is);
+        REQUIRE(docs.size() == 2);
+        REQUIRE(docs[0]["foo"].get_value<int>() == 1);
+        REQUIRE(docs[1]["bar"].get_value<int>() == 2);
+    }
+}
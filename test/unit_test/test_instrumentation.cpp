@@ -0,0 +1,145 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace {
+
+/// @brief Collects statistics reported while an object is alive.
+struct stats_collector {
+    stats_collector() {
+        fkyaml::set_parse_stats_callback([this](const fkyaml::parse_stats& stats) { reported.push_back(stats); });
+    }
+
+    ~stats_collector() {
+        fkyaml::set_parse_stats_callback(nullptr);
+    }
+
+    std::vector<fkyaml::parse_stats> reported;
+};
+
+} // namespace
+
+TEST_CASE("Instrumentation_ParsePhaseToString") {
+    using test_data_t = std::pair<fkyaml::parse_phase, std::string>;
+    auto test_data = GENERATE(
+        test_data_t {fkyaml::parse_phase::INPUT_NORMALIZATION, "INPUT_NORMALIZATION"},
+        test_data_t {fkyaml::parse_phase::LEXING, "LEXING"},
+        test_data_t {fkyaml::parse_phase::SCALAR_CONVERSION, "SCALAR_CONVERSION"},
+        test_data_t {fkyaml::parse_phase::TREE_BUILDING, "TREE_BUILDING"},
+        test_data_t {fkyaml::parse_phase::ANCHOR_HANDLING, "ANCHOR_HANDLING"});
+    REQUIRE(test_data.second == fkyaml::to_string(test_data.first));
+}
+
+TEST_CASE("Instrumentation_Counters") {
+    stats_collector collector;
+
+    SECTION("YAML input") {
+        fkyaml::node::deserialize(
+            "foo: &anchor \"bar\\tbaz\\n\"\n"
+            "qux: [*anchor, 1, 2.5, true, null]\n"
+            "quux: |\n  a\n  b\n");
+        REQUIRE(collector.reported.size() == 1);
+
+        const fkyaml::parse_stats& stats = collector.reported[0];
+        REQUIRE(stats.num_tokens > 0);
+        REQUIRE(stats.nodes(fkyaml::node_type::SEQUENCE) == 1);
+        REQUIRE(stats.nodes(fkyaml::node_type::MAPPING) == 1);
+        REQUIRE(stats.nodes(fkyaml::node_type::NULL_OBJECT) == 1);
+        REQUIRE(stats.nodes(fkyaml::node_type::BOOLEAN) == 1);
+        REQUIRE(stats.nodes(fkyaml::node_type::INTEGER) == 1);
+        REQUIRE(stats.nodes(fkyaml::node_type::FLOAT) == 1);
+        REQUIRE(stats.nodes(fkyaml::node_type::STRING) == 6);
+        REQUIRE(stats.input_bytes_copied == 0);
+        REQUIRE(stats.scalar_bytes_copied == std::string("bar\tbaz\n").size() + std::string("a\nb\n").size());
+        REQUIRE(stats.num_unescapes == 2);
+        REQUIRE(stats.num_anchor_lookups == 1);
+    }
+
+    SECTION("JSON input") {
+        fkyaml::node::deserialize("{\"foo\": [1, 2], \"bar\": \"baz\"}");
+        REQUIRE(collector.reported.size() == 1);
+
+        // the JSON subset parser doesn't tokenize inputs with the lexical analyzer.
+        const fkyaml::parse_stats& stats = collector.reported[0];
+        REQUIRE(stats.num_tokens == 0);
+        REQUIRE(stats.nodes(fkyaml::node_type::MAPPING) == 1);
+        REQUIRE(stats.nodes(fkyaml::node_type::SEQUENCE) == 1);
+        REQUIRE(stats.nodes(fkyaml::node_type::INTEGER) == 2);
+        REQUIRE(stats.nodes(fkyaml::node_type::STRING) == 3);
+    }
+
+    SECTION("normalized inputs") {
+        auto input = GENERATE(
+            std::string("foo: bar\r\nbaz: 123\r\n"),
+            std::string("\xFF\xFE"
+                        "f\0o\0o\0:\0 \0b\0a\0r\0\n\0b\0a\0z\0:\0 \0001\0002\0003\0\n\0",
+                        38));
+        fkyaml::node::deserialize(input);
+        REQUIRE(collector.reported.size() == 1);
+        REQUIRE(collector.reported[0].input_bytes_copied == std::string("foo: bar\nbaz: 123\n").size());
+    }
+}
+
+TEST_CASE("Instrumentation_Sessions") {
+    stats_collector collector;
+
+    SECTION("multiple documents") {
+        fkyaml::node::deserialize_docs("foo: 1\n---\n- bar\n- 2\n");
+        REQUIRE(collector.reported.size() == 1);
+        REQUIRE(collector.reported[0].nodes(fkyaml::node_type::MAPPING) == 1);
+        REQUIRE(collector.reported[0].nodes(fkyaml::node_type::SEQUENCE) == 1);
+        REQUIRE(collector.reported[0].nodes(fkyaml::node_type::INTEGER) == 2);
+        REQUIRE(collector.reported[0].nodes(fkyaml::node_type::STRING) == 2);
+    }
+
+    SECTION("reused parser") {
+        fkyaml::parser parser;
+        parser.deserialize("foo: bar");
+        parser.deserialize("- 1\n- 2\n");
+        REQUIRE(collector.reported.size() == 2);
+        REQUIRE(collector.reported[0].nodes(fkyaml::node_type::STRING) == 2);
+        REQUIRE(collector.reported[1].nodes(fkyaml::node_type::INTEGER) == 2);
+    }
+
+    SECTION("failed deserialization") {
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize("foo: *bar"), fkyaml::parse_error);
+        REQUIRE(collector.reported.size() == 1);
+        REQUIRE(collector.reported[0].num_anchor_lookups == 1);
+    }
+
+    SECTION("durations") {
+        fkyaml::node::deserialize("foo: [1, 2, 3]\nbar: baz\n");
+        REQUIRE(collector.reported.size() == 1);
+
+        const fkyaml::parse_stats& stats = collector.reported[0];
+        std::chrono::nanoseconds sum {0};
+        for (const auto& d : stats.durations) {
+            REQUIRE(d.count() >= 0);
+            sum += d;
+        }
+        REQUIRE(stats.total_duration() == sum);
+        REQUIRE(stats.duration(fkyaml::parse_phase::LEXING) == stats.durations[1]);
+    }
+}
+
+TEST_CASE("Instrumentation_NoCallback") {
+    std::vector<fkyaml::parse_stats> reported;
+    fkyaml::set_parse_stats_callback([&reported](const fkyaml::parse_stats& stats) { reported.push_back(stats); });
+    fkyaml::set_parse_stats_callback(nullptr);
+
+    REQUIRE(fkyaml::node::deserialize("foo: bar")["foo"].get_value<std::string>() == "bar");
+    REQUIRE(reported.empty());
+}
@@ -0,0 +1,154 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <clocale>
+#include <limits>
+#include <sstream>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+TEST_CASE("JsonSerializer_SequenceNode") {
+    using node_str_pair_t = std::pair<fkyaml::node, std::string>;
+    auto node_str_pair = GENERATE(
+        node_str_pair_t(fkyaml::node::sequence(), "[]"),
+        node_str_pair_t({true, false}, "[true,false]"),
+        node_str_pair_t({{{"foo", -1234}, {"bar", nullptr}}}, "[{\"bar\":null,\"foo\":-1234}]"));
+    fkyaml::detail::basic_json_serializer<fkyaml::node> serializer;
+    REQUIRE(serializer.serialize(node_str_pair.first) == node_str_pair.second);
+}
+
+TEST_CASE("JsonSerializer_MappingNode") {
+    using node_str_pair_t = std::pair<fkyaml::node, std::string>;
+    auto node_str_pair = GENERATE(
+        node_str_pair_t(fkyaml::node::mapping(), "{}"),
+        node_str_pair_t({{"foo", -1234}, {"bar", nullptr}}, "{\"bar\":null,\"foo\":-1234}"),
+        node_str_pair_t({{"foo", {true, false}}}, "{\"foo\":[true,false]}"),
+        node_str_pair_t(
+            {{nullptr, 1}, {true, 2}, {123, 3}, {3.14, 4}}, "{\"null\":1,\"true\":2,\"123\":3,\"3.14\":4}"));
+    fkyaml::detail::basic_json_serializer<fkyaml::node> serializer;
+    REQUIRE(serializer.serialize(node_str_pair.first) == node_str_pair.second);
+}
+
+TEST_CASE("JsonSerializer_ContainerKey") {
+    fkyaml::node node = fkyaml::node::mapping();
+    node.get_value_ref<fkyaml::node::mapping_type&>().emplace(fkyaml::node {1, 2}, 3);
+    fkyaml::detail::basic_json_serializer<fkyaml::node> serializer;
+    REQUIRE_THROWS_AS(serializer.serialize(node), fkyaml::type_error);
+}
+
+TEST_CASE("JsonSerializer_ScalarNode") {
+    using node_str_pair_t = std::pair<fkyaml::node, std::string>;
+    auto node_str_pair = GENERATE(
+        node_str_pair_t(nullptr, "null"),
+        node_str_pair_t(true, "true"),
+        node_str_pair_t(false, "false"),
+        node_str_pair_t(0, "0"),
+        node_str_pair_t(-1234, "-1234"),
+        node_str_pair_t(std::numeric_limits<int64_t>::min(), "-9223372036854775808"),
+        node_str_pair_t(std::numeric_limits<int64_t>::max(), "9223372036854775807"));
+    fkyaml::detail::basic_json_serializer<fkyaml::node> serializer;
+    REQUIRE(serializer.serialize(node_str_pair.first) == node_str_pair.second);
+}
+
+TEST_CASE("JsonSerializer_FloatNode") {
+    using node_str_pair_t = std::pair<fkyaml::node, std::string>;
+    auto node_str_pair = GENERATE(
+        node_str_pair_t(0.0, "0.0"),
+        node_str_pair_t(-2.0, "-2.0"),
+        node_str_pair_t(2.10, "2.1"),
+        node_str_pair_t(0.1, "0.1"),
+        node_str_pair_t(3.14159265358979, "3.14159265358979"),
+        node_str_pair_t(std::numeric_limits<fkyaml::node::float_number_type>::infinity(), "null"),
+        node_str_pair_t(-std::numeric_limits<fkyaml::node::float_number_type>::infinity(), "null"),
+        node_str_pair_t(std::numeric_limits<fkyaml::node::float_number_type>::quiet_NaN(), "null"));
+    fkyaml::detail::basic_json_serializer<fkyaml::node> serializer;
+    REQUIRE(serializer.serialize(node_str_pair.first) == node_str_pair.second);
+}
+
+TEST_CASE("JsonSerializer_FloatNodeRoundTrip") {
+    auto value = GENERATE(
+        1e-300,
+        1.7976931348623157e308,
+        0.30000000000000004,
+        123456.789,
+        5e-324,
+        -1e20);
+    fkyaml::detail::basic_json_serializer<fkyaml::node> serializer;
+    std::string str = serializer.serialize(fkyaml::node(value));
+    REQUIRE(std::strtod(str.c_str(), nullptr) == value);
+}
+
+TEST_CASE("JsonSerializer_FloatNodeInCommaDecimalLocale") {
+    // JSON numbers always use '.' as the decimal point regardless of LC_NUMERIC.
+    // This test is effective only on platforms where one of the following locales is installed.
+    const std::string prev_locale = std::setlocale(LC_NUMERIC, nullptr);
+    const char* locales[] = {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8", "German_Germany.1252"};
+    for (const char* locale : locales) {
+        if (std::setlocale(LC_NUMERIC, locale) != nullptr) {
+            break;
+        }
+    }
+
+    fkyaml::detail::basic_json_serializer<fkyaml::node> serializer;
+    std::string str = serializer.serialize(fkyaml::node {{"foo", 1.5}, {"bar", 1.25e-10}});
+    std::setlocale(LC_NUMERIC, prev_locale.c_str());
+    REQUIRE(str == "{\"bar\":1.25e-10,\"foo\":1.5}");
+}
+
+TEST_CASE("JsonSerializer_StringNode") {
+    using node_str_pair_t = std::pair<fkyaml::node, std::string>;
+    auto node_str_pair = GENERATE(
+        node_str_pair_t("", "\"\""),
+        node_str_pair_t("foo", "\"foo\""),
+        node_str_pair_t("123", "\"123\""),
+        node_str_pair_t("true", "\"true\""),
+        node_str_pair_t("quote\"backslash\\", "\"quote\\\"backslash\\\\\""),
+        node_str_pair_t("\b\f\n\r\t", "\"\\b\\f\\n\\r\\t\""),
+        node_str_pair_t(std::string("\x00\x01\x1F", 3), "\"\\u0000\\u0001\\u001F\""),
+        node_str_pair_t("/", "\"/\""),
+        node_str_pair_t("\xE3\x81\x82", "\"\xE3\x81\x82\""));
+    fkyaml::detail::basic_json_serializer<fkyaml::node> serializer;
+    REQUIRE(serializer.serialize(node_str_pair.first) == node_str_pair.second);
+}
+
+TEST_CASE("JsonSerializer_AnchorAndAliasNode") {
+    fkyaml::node node = fkyaml::node::deserialize("foo: &anchor !!str bar\n"
+                                                  "baz: *anchor\n"
+                                                  "qux: &seq [1, *anchor]\n");
+    fkyaml::detail::basic_json_serializer<fkyaml::node> serializer;
+    REQUIRE(serializer.serialize(node) == "{\"baz\":\"bar\",\"foo\":\"bar\",\"qux\":[1,\"bar\"]}");
+}
+
+TEST_CASE("JsonSerializer_Pretty") {
+    fkyaml::node node = {{"foo", {1, {{"bar", true}}, fkyaml::node::sequence()}}, {"baz", fkyaml::node::mapping()}};
+    fkyaml::detail::basic_json_serializer<fkyaml::node> serializer(true);
+    REQUIRE(
+        serializer.serialize(node) == "{\n"
+                                      "  \"baz\": {},\n"
+                                      "  \"foo\": [\n"
+                                      "    1,\n"
+                                      "    {\n"
+                                      "      \"bar\": true\n"
+                                      "    },\n"
+                                      "    []\n"
+                                      "  ]\n"
+                                      "}");
+}
+
+TEST_CASE("JsonSerializer_OutputStream") {
+    std::string long_str(3000, 'a');
+    fkyaml::node node = {{"foo", long_str}, {"bar", {1, 2, 3}}};
+    fkyaml::detail::basic_json_serializer<fkyaml::node> serializer;
+
+    std::ostringstream oss;
+    serializer.serialize(node, oss);
+    REQUIRE(oss.str() == serializer.serialize(node));
+    REQUIRE(oss.str() == "{\"bar\":[1,2,3],\"foo\":\"" + long_str + "\"}");
+}
@@ -0,0 +1,119 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+TEST_CASE("JsonSubsetParser_IsCandidate") {
+    using parser_t = fkyaml::detail::json_subset_parser<fkyaml::node>;
+
+    SECTION("candidates") {
+        auto input = GENERATE(
+            fkyaml::detail::str_view("{}"),
+            fkyaml::detail::str_view("[]"),
+            fkyaml::detail::str_view(" \t\r\n{\"foo\": 123}"),
+            fkyaml::detail::str_view("[1, 2, 3]"));
+        REQUIRE(parser_t::is_candidate(input));
+    }
+
+    SECTION("non-candidates") {
+        auto input = GENERATE(
+            fkyaml::detail::str_view(""),
+            fkyaml::detail::str_view("   "),
+            fkyaml::detail::str_view("foo: bar"),
+            fkyaml::detail::str_view("# comment\n{}"),
+            fkyaml::detail::str_view("--- []"),
+            fkyaml::detail::str_view("\"foo\""));
+        REQUIRE_FALSE(parser_t::is_candidate(input));
+    }
+}
+
+TEST_CASE("JsonSubsetParser_Parse") {
+    fkyaml::detail::json_subset_parser<fkyaml::node> parser;
+    fkyaml::node root;
+
+    SECTION("empty containers") {
+        REQUIRE(parser.parse("[]", root));
+        REQUIRE(root.is_sequence());
+        REQUIRE(root.empty());
+
+        REQUIRE(parser.parse(" { } \n", root));
+        REQUIRE(root.is_mapping());
+        REQUIRE(root.empty());
+    }
+
+    SECTION("nested containers") {
+        REQUIRE(parser.parse(
+            "{\n"
+            "  \"foo\": [true, false, null, {}],\n"
+            "  \"bar\": {\"baz\": [[], [-12, 0, 3.5e-2, 1E3]]},\n"
+            "  \"qux\": \"a\\\"b\\\\c\\/d\\n\\u00E9\"\n"
+            "}",
+            root));
+        REQUIRE(root.is_mapping());
+        REQUIRE(root.size() == 3);
+
+        fkyaml::node& foo = root["foo"];
+        REQUIRE(foo.is_sequence());
+        REQUIRE(foo.size() == 4);
+        REQUIRE(foo[0].get_value<bool>() == true);
+        REQUIRE(foo[1].get_value<bool>() == false);
+        REQUIRE(foo[2].is_null());
+        REQUIRE(foo[3].is_mapping());
+        REQUIRE(foo[3].empty());
+
+        fkyaml::node& baz = root["bar"]["baz"];
+        REQUIRE(baz.is_sequence());
+        REQUIRE(baz.size() == 2);
+        REQUIRE(baz[0].is_sequence());
+        REQUIRE(baz[0].empty());
+        REQUIRE(baz[1].size() == 4);
+        REQUIRE(baz[1][0].get_value<int>() == -12);
+        REQUIRE(baz[1][1].get_value<int>() == 0);
+        REQUIRE(baz[1][2].get_value<double>() == 3.5e-2);
+        REQUIRE(baz[1][3].get_value<double>() == 1e3);
+
+        fkyaml::node& qux = root["qux"];
+        REQUIRE(qux.is_string());
+        REQUIRE(qux.get_value_ref<std::string&>() == "a\"b\\c/d\n\xC3\xA9");
+    }
+
+    SECTION("inputs which leave the JSON subset") {
+        auto input = GENERATE(
+            fkyaml::detail::str_view("foo: bar"),
+            fkyaml::detail::str_view("["),
+            fkyaml::detail::str_view("[1, 2"),
+            fkyaml::detail::str_view("[1, 2,]"),
+            fkyaml::detail::str_view("[1 2]"),
+            fkyaml::detail::str_view("[1, 2] # comment"),
+            fkyaml::detail::str_view("[1, 2]\n---\n[3]"),
+            fkyaml::detail::str_view("[foo]"),
+            fkyaml::detail::str_view("['foo']"),
+            fkyaml::detail::str_view("[\"foo\nbar\"]"),
+            fkyaml::detail::str_view("[\"\\x41\"]"),
+            fkyaml::detail::str_view("[\"\\u004\"]"),
+            fkyaml::detail::str_view("[\"foo]"),
+            fkyaml::detail::str_view("[01]"),
+            fkyaml::detail::str_view("[+1]"),
+            fkyaml::detail::str_view("[.5]"),
+            fkyaml::detail::str_view("[1.]"),
+            fkyaml::detail::str_view("[1e]"),
+            fkyaml::detail::str_view("[-]"),
+            fkyaml::detail::str_view("[True]"),
+            fkyaml::detail::str_view("[nulls]"),
+            fkyaml::detail::str_view("[&anchor 1, *anchor]"),
+            fkyaml::detail::str_view("[!!str 1]"),
+            fkyaml::detail::str_view("{foo: 1}"),
+            fkyaml::detail::str_view("{\"foo\" 1}"),
+            fkyaml::detail::str_view("{\"foo\":}"),
+            fkyaml::detail::str_view("{\"foo\": 1, \"foo\": 2}"),
+            fkyaml::detail::str_view("{\"foo\": 1]"));
+        REQUIRE_FALSE(parser.parse(input, root));
+    }
+}
@@ -0,0 +1,77 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+TEST_CASE("KeyInternTable_Intern") {
+    fkyaml::detail::key_intern_table table {};
+    REQUIRE(table.size() == 0);
+
+    std::string foo = "foo";
+    fkyaml::detail::str_view interned_foo {};
+    REQUIRE(table.intern(fkyaml::detail::str_view(foo), interned_foo));
+    REQUIRE(interned_foo == "foo");
+    REQUIRE(interned_foo.data() != foo.data());
+    REQUIRE(table.size() == 1);
+
+    // equal keys are interned into the same characters.
+    std::string foo2 = "foo";
+    fkyaml::detail::str_view interned_foo2 {};
+    REQUIRE(table.intern(fkyaml::detail::str_view(foo2), interned_foo2));
+    REQUIRE(interned_foo2.data() == interned_foo.data());
+    REQUIRE(interned_foo2.size() == 3);
+    REQUIRE(table.size() == 1);
+
+    // the interned strings never move even if many other keys are added.
+    for (int i = 0; i < 100; i++) {
+        std::string key = "key" + std::to_string(i) + std::string(32, 'x');
+        fkyaml::detail::str_view interned {};
+        REQUIRE(table.intern(fkyaml::detail::str_view(key), interned));
+        REQUIRE(interned == fkyaml::detail::str_view(key));
+    }
+    REQUIRE(table.size() == 101);
+    REQUIRE(table.intern(fkyaml::detail::str_view(foo), interned_foo2));
+    REQUIRE(interned_foo2.data() == interned_foo.data());
+
+    // an empty key is also interned.
+    fkyaml::detail::str_view interned_empty {};
+    REQUIRE(table.intern(fkyaml::detail::str_view(), interned_empty));
+    REQUIRE(interned_empty.empty());
+    REQUIRE(table.size() == 102);
+}
+
+TEST_CASE("KeyInternTable_MaxSize") {
+    fkyaml::detail::key_intern_table table {2};
+    fkyaml::detail::str_view interned {};
+    REQUIRE(table.intern("foo", interned));
+    REQUIRE(table.intern("bar", interned));
+
+    // no more distinct keys are added but the existing ones are still available.
+    REQUIRE_FALSE(table.intern("baz", interned));
+    REQUIRE(table.size() == 2);
+    REQUIRE(table.intern("foo", interned));
+    REQUIRE(interned == "foo");
+}
+
+TEST_CASE("KeyInternTable_MemoryUsage") {
+    fkyaml::detail::key_intern_table table {};
+    std::size_t empty_usage = table.memory_usage();
+
+    fkyaml::detail::str_view interned {};
+    REQUIRE(table.intern("foo", interned));
+    std::size_t short_key_usage = table.memory_usage();
+    REQUIRE(short_key_usage >= empty_usage + sizeof(std::string));
+
+    const std::string long_key = "a mapping key which is too long to be stored in the string object itself";
+    REQUIRE(table.intern(fkyaml::detail::str_view(long_key), interned));
+    REQUIRE(table.memory_usage() >= short_key_usage + sizeof(std::string) + long_key.size());
+}
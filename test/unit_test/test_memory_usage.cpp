@@ -0,0 +1,126 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace {
+
+/// A string long enough to be allocated on the heap with any small string optimization.
+const std::string long_str = "a string value which is too long to be stored in the string object itself";
+
+} // namespace
+
+TEST_CASE("MemoryUsage_Total") {
+    fkyaml::node_memory_usage usage {};
+    REQUIRE(usage.total() == 0);
+
+    usage.node_bytes = 1;
+    usage.container_bytes = 2;
+    usage.string_bytes = 4;
+    usage.slack_bytes = 8;
+    usage.metainfo_bytes = 16;
+    usage.anchor_table_bytes = 32;
+    REQUIRE(usage.total() == 63);
+}
+
+TEST_CASE("MemoryUsage_Scalars") {
+    SECTION("non-string scalars") {
+        auto node = GENERATE(fkyaml::node(), fkyaml::node(true), fkyaml::node(123), fkyaml::node(3.14));
+        fkyaml::node_memory_usage usage = fkyaml::memory_usage(node);
+        REQUIRE(usage.node_bytes == sizeof(fkyaml::node));
+        REQUIRE(usage.container_bytes == 0);
+        REQUIRE(usage.string_bytes == 0);
+        REQUIRE(usage.slack_bytes == 0);
+        REQUIRE(usage.metainfo_bytes >= sizeof(fkyaml::detail::document_metainfo<fkyaml::node>));
+        REQUIRE(usage.anchor_table_bytes == 0);
+    }
+
+    SECTION("strings") {
+        fkyaml::node_memory_usage short_usage = fkyaml::memory_usage(fkyaml::node("foo"));
+        REQUIRE(short_usage.string_bytes == sizeof(fkyaml::node::string_type));
+
+        fkyaml::node_memory_usage long_usage = fkyaml::memory_usage(fkyaml::node(long_str));
+        REQUIRE(long_usage.string_bytes > sizeof(fkyaml::node::string_type) + long_str.size());
+    }
+
+    SECTION("properties") {
+        const std::string tag = "!<tag:example.com,2000:a_tag_which_is_too_long_to_be_stored_in_the_string_object>";
+        fkyaml::node node = fkyaml::node::deserialize(tag + " foo");
+        REQUIRE(fkyaml::memory_usage(node).string_bytes > sizeof(fkyaml::node::string_type) + tag.size());
+    }
+}
+
+TEST_CASE("MemoryUsage_Containers") {
+    SECTION("sequence") {
+        fkyaml::node node = fkyaml::node::sequence();
+        auto& seq = node.get_value_ref<fkyaml::node::sequence_type&>();
+        seq.reserve(8);
+        seq.emplace_back(1);
+        seq.emplace_back(2);
+
+        fkyaml::node_memory_usage usage = fkyaml::memory_usage(node);
+        REQUIRE(usage.node_bytes == 3 * sizeof(fkyaml::node));
+        REQUIRE(usage.container_bytes == sizeof(fkyaml::node::sequence_type));
+        REQUIRE(usage.slack_bytes == (seq.capacity() - 2) * sizeof(fkyaml::node));
+        REQUIRE(usage.string_bytes == 0);
+    }
+
+    SECTION("mapping") {
+        fkyaml::node node = fkyaml::node::deserialize("foo: 1\nbar: [true, false]\n");
+        fkyaml::node_memory_usage usage = fkyaml::memory_usage(node);
+        REQUIRE(usage.node_bytes == sizeof(fkyaml::node) + 2 * sizeof(fkyaml::node::mapping_type::value_type) +
+                                        node["bar"].size() * sizeof(fkyaml::node));
+        REQUIRE(usage.container_bytes > sizeof(fkyaml::node::mapping_type) + sizeof(fkyaml::node::sequence_type));
+        REQUIRE(usage.string_bytes == 2 * sizeof(fkyaml::node::string_type));
+    }
+}
+
+TEST_CASE("MemoryUsage_AnchorTable") {
+    fkyaml::node node = fkyaml::node::deserialize("foo: &anchor\n  - " + long_str + "\nbar: *anchor\n");
+    fkyaml::node_memory_usage usage = fkyaml::memory_usage(node);
+
+    // the anchored sequence is stored once in the anchor table.
+    REQUIRE(usage.anchor_table_bytes > sizeof(fkyaml::node::sequence_type) + long_str.size());
+    fkyaml::node_memory_usage scalars_usage = fkyaml::memory_usage(fkyaml::node::deserialize("foo: 1\nbar: 2\n"));
+    REQUIRE(usage.container_bytes == scalars_usage.container_bytes);
+    REQUIRE(usage.string_bytes < long_str.size());
+
+    // the document metainfo, including the anchor table, is counted even for a descendant node.
+    fkyaml::node_memory_usage foo_usage = fkyaml::memory_usage(node["foo"]);
+    REQUIRE(foo_usage.anchor_table_bytes == usage.anchor_table_bytes);
+    REQUIRE(foo_usage.metainfo_bytes == usage.metainfo_bytes);
+}
+
+TEST_CASE("MemoryUsage_SharedBuffers") {
+    const std::string input = "foo: " + long_str + "\nbar: baz\n";
+
+    SECTION("input buffer of borrowed strings") {
+        fkyaml::node node = fkyaml::node::deserialize_borrowed(input);
+        fkyaml::node_memory_usage usage = fkyaml::memory_usage(node);
+        fkyaml::node_memory_usage copied_usage = fkyaml::memory_usage(fkyaml::node::deserialize(input));
+
+        // the borrowed string values are counted once as the input buffer in the metainfo.
+        REQUIRE(usage.string_bytes < long_str.size());
+        REQUIRE(usage.metainfo_bytes >= copied_usage.metainfo_bytes + input.size());
+    }
+
+    SECTION("key table shared among documents") {
+        auto p_key_table = std::make_shared<fkyaml::node::key_intern_table_type>();
+        std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs(input + "---\n" + input, p_key_table);
+        REQUIRE(docs.size() == 2);
+
+        fkyaml::node_memory_usage usage = fkyaml::memory_usage(docs[0]);
+        REQUIRE(usage.metainfo_bytes > sizeof(fkyaml::detail::key_intern_table) + p_key_table->memory_usage());
+    }
+}
@@ -9,7 +9,9 @@
 #include <cmath>
 #include <cfloat>
 #include <fstream>
+#include <functional>
 #include <sstream>
+#include <thread>
 #include <map>
 
 #include <catch2/catch.hpp>
@@ -434,6 +436,154 @@ TEST_CASE("Node_Deserialize") {
     REQUIRE(node["foo"].get_value_ref<std::string&>() == "bar");
 }
 
+TEST_CASE("Node_DeserializeBorrowed") {
+    // copies of a borrowed string node refer to the same characters.
+    auto is_borrowed = [](const fkyaml::node& n) {
+        fkyaml::node copied = n;
+        return copied.get_value<fkyaml::detail::str_view>().data() == n.get_value<fkyaml::detail::str_view>().data();
+    };
+
+    SECTION("strings which need no mutation refer to the copy of the input") {
+        char source[] = "foo: bar\nbaz: [qux, 'a''b', \"c\\td\"]";
+        fkyaml::node node = GENERATE_REF(
+            fkyaml::node::deserialize_borrowed(source),
+            fkyaml::node::deserialize_borrowed(&source[0], &source[sizeof(source) - 1]),
+            fkyaml::node::deserialize_borrowed(std::string(source)));
+        REQUIRE(node == fkyaml::node::deserialize(source));
+
+        REQUIRE(is_borrowed(node["foo"]));
+        REQUIRE(is_borrowed(node["baz"][0]));
+        REQUIRE_FALSE(is_borrowed(node["baz"][1]));
+        REQUIRE_FALSE(is_borrowed(node["baz"][2]));
+        for (const auto& pair : node.get_value_ref<const fkyaml::node::mapping_type&>()) {
+            REQUIRE(is_borrowed(pair.first));
+        }
+
+        auto foo_view = node["foo"].get_value<fkyaml::detail::str_view>();
+        REQUIRE(
+            (std::less<const char*>()(foo_view.data(), &source[0]) ||
+             std::less<const char*>()(&source[sizeof(source) - 1], foo_view.data())));
+    }
+
+    SECTION("JSON inputs") {
+        fkyaml::node node = fkyaml::node::deserialize_borrowed("{\"foo\": [\"bar\", \"b\\u0061z\"]}");
+        REQUIRE(is_borrowed(node["foo"][0]));
+        REQUIRE_FALSE(is_borrowed(node["foo"][1]));
+        REQUIRE(node["foo"][1].get_value<std::string>() == "baz");
+    }
+
+    SECTION("the copy of the input is kept alive by the resulting nodes") {
+        fkyaml::node foo;
+        {
+            std::string input = "foo: bar\n";
+            fkyaml::node root = fkyaml::node::deserialize_borrowed(input);
+            foo = root["foo"];
+            input.assign(input.size(), 'x');
+        }
+        REQUIRE(is_borrowed(foo));
+        REQUIRE(foo.get_value<std::string>() == "bar");
+        REQUIRE(fkyaml::node::serialize(foo) == "bar");
+
+        foo.get_value_ref<std::string&>() += "!";
+        REQUIRE_FALSE(is_borrowed(foo));
+        REQUIRE(foo.get_value<std::string>() == "bar!");
+    }
+
+    SECTION("const nodes are never modified") {
+        const fkyaml::node node = fkyaml::node::deserialize_borrowed("foo: bar");
+        const fkyaml::node& foo = node["foo"];
+        REQUIRE_THROWS_AS(foo.get_value_ref<const std::string&>(), fkyaml::type_error);
+        REQUIRE(is_borrowed(foo));
+        REQUIRE(foo.get_value<std::string>() == "bar");
+
+        for (const auto& pair : node.get_value_ref<const fkyaml::node::mapping_type&>()) {
+            REQUIRE_THROWS_AS(pair.first.get_value_ref<const std::string&>(), fkyaml::type_error);
+            REQUIRE(is_borrowed(pair.first));
+            REQUIRE(pair.first.get_value<std::string>() == "foo");
+        }
+    }
+}
+
+TEST_CASE("Node_DeserializeInto") {
+    char source[] = "foo: [1, 2]";
+    std::stringstream ss;
+    ss << source;
+
+    using map_type = std::map<std::string, std::vector<int>>;
+    map_type value = GENERATE_REF(
+        fkyaml::node::deserialize_into<map_type>("foo: [1, 2]"),
+        fkyaml::node::deserialize_into<map_type>(source),
+        fkyaml::node::deserialize_into<map_type>(&source[0], &source[11]),
+        fkyaml::node::deserialize_into<map_type>(std::string(source)),
+        fkyaml::node::deserialize_into<map_type>(ss));
+
+    REQUIRE(value.size() == 1);
+    REQUIRE(value.at("foo") == std::vector<int> {1, 2});
+}
+
+TEST_CASE("Node_DeserializeInPlace") {
+    auto is_in = [](fkyaml::detail::str_view view, const std::string& input) {
+        return std::less_equal<const char*>()(input.data(), view.data()) &&
+               std::less_equal<const char*>()(view.end(), input.data() + input.size());
+    };
+
+    SECTION("strings which need no mutation refer to the input") {
+        std::string input = "foo: bar\n'baz': [qux, \"a\\tb\", 'c''d']\n";
+        fkyaml::node node = fkyaml::node::deserialize_in_place(input);
+        REQUIRE(node == fkyaml::node::deserialize(input));
+
+        REQUIRE(is_in(node["foo"].get_value<fkyaml::detail::str_view>(), input));
+        REQUIRE(is_in(node["baz"][0].get_value<fkyaml::detail::str_view>(), input));
+        REQUIRE_FALSE(is_in(node["baz"][1].get_value<fkyaml::detail::str_view>(), input));
+        REQUIRE_FALSE(is_in(node["baz"][2].get_value<fkyaml::detail::str_view>(), input));
+        for (const auto& pair : node.get_value_ref<const fkyaml::node::mapping_type&>()) {
+            REQUIRE(is_in(pair.first.get_value<fkyaml::detail::str_view>(), input));
+        }
+    }
+
+    SECTION("JSON inputs") {
+        std::string input = "{\"foo\": [\"bar\", \"b\\u0061z\"]}";
+        fkyaml::node node = fkyaml::node::deserialize_in_place(&input[0], &input[0] + input.size());
+        REQUIRE(node == fkyaml::node::deserialize(input));
+        REQUIRE(is_in(node["foo"][0].get_value<fkyaml::detail::str_view>(), input));
+        REQUIRE_FALSE(is_in(node["foo"][1].get_value<fkyaml::detail::str_view>(), input));
+    }
+
+    SECTION("inputs normalized into an owned buffer") {
+        std::string input = "foo: bar\r\n";
+        fkyaml::node node = fkyaml::node::deserialize_in_place(input);
+        REQUIRE_FALSE(is_in(node["foo"].get_value<fkyaml::detail::str_view>(), input));
+        REQUIRE(node["foo"].get_value<std::string>() == "bar");
+    }
+
+    SECTION("borrowed strings") {
+        std::string input = "- foo\n- bar\n";
+        fkyaml::node node = fkyaml::node::deserialize_in_place(input);
+        fkyaml::node& foo = node[0];
+        REQUIRE(foo.is_string());
+        REQUIRE(foo.size() == 3);
+        REQUIRE_FALSE(foo.empty());
+        REQUIRE(foo == fkyaml::node("foo"));
+        REQUIRE(node[1] < foo);
+        REQUIRE(fkyaml::node::serialize(node) == "- foo\n- bar\n");
+
+        fkyaml::node copied = foo;
+        REQUIRE(copied.get_value<fkyaml::detail::str_view>().data() == &input[2]);
+        fkyaml::node moved = std::move(copied);
+        REQUIRE(moved.get_value<fkyaml::detail::str_view>().data() == &input[2]);
+
+        // references to borrowed strings are made to owned copies.
+        moved.get_value_ref<std::string&>() += "!";
+        REQUIRE(moved.get_value<std::string>() == "foo!");
+        REQUIRE_FALSE(is_in(moved.get_value<fkyaml::detail::str_view>(), input));
+        REQUIRE(foo.get_value<fkyaml::detail::str_view>().data() == &input[2]);
+
+        foo = 123;
+        REQUIRE(foo.get_value<int>() == 123);
+        REQUIRE(input == "- foo\n- bar\n");
+    }
+}
+
 TEST_CASE("Node_DeserializeDocs") {
     char source[] = "foo: bar\n"
                     "...\n"
@@ -476,6 +626,148 @@ TEST_CASE("Node_DeserializeDocs") {
     REQUIRE(seq2.is_null());
 }
 
+TEST_CASE("Node_DeserializeDocsParallel") {
+    std::string source = "foo: bar\n"
+                         "...\n"
+                         "- true\n"
+                         "- 3.14\n"
+                         "- Null\n"
+                         "--- |\n"
+                         "  ---\n";
+    std::vector<fkyaml::node> expected = fkyaml::node::deserialize_docs(source);
+
+    SECTION("with threads") {
+        std::size_t num_threads = GENERATE(std::size_t(0), std::size_t(1), std::size_t(3));
+        std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs_parallel(source, num_threads);
+        REQUIRE(docs.size() == 3);
+        REQUIRE(docs == expected);
+        REQUIRE(docs[2].get_value_ref<std::string&>() == "---\n");
+    }
+
+    SECTION("with a custom executor") {
+        std::vector<std::thread> threads;
+        auto executor = [&threads](std::function<void()> task) { threads.emplace_back(std::move(task)); };
+
+        std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs_parallel(source, executor, 2);
+        REQUIRE(threads.size() == 2);
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        REQUIRE(docs == expected);
+    }
+}
+
+TEST_CASE("Node_DocumentStream") {
+    char source[] = "foo: bar\n"
+                    "...\n"
+                    "- true\n"
+                    "- 3.14\n"
+                    "- Null";
+    std::stringstream ss;
+    ss << source;
+    std::string str_source(source);
+
+    std::vector<fkyaml::node> docs;
+    SECTION("string") {
+        for (auto& doc : fkyaml::node::document_stream(str_source)) {
+            docs.emplace_back(std::move(doc));
+        }
+    }
+    SECTION("iterators") {
+        for (auto& doc : fkyaml::node::document_stream(&source[0], &source[33])) {
+            docs.emplace_back(std::move(doc));
+        }
+    }
+    SECTION("stream") {
+        for (auto& doc : fkyaml::node::document_stream(ss)) {
+            docs.emplace_back(std::move(doc));
+        }
+    }
+
+    REQUIRE(docs.size() == 2);
+    REQUIRE(docs[0]["foo"].get_value_ref<std::string&>() == "bar");
+    REQUIRE(docs[1].is_sequence());
+    REQUIRE(docs[1].size() == 3);
+    REQUIRE(docs[1][2].is_null());
+}
+
+TEST_CASE("Node_KeyInterning") {
+    auto key_data = [](const fkyaml::node& map, std::size_t idx) {
+        auto itr = map.get_value_ref<const fkyaml::node::mapping_type&>().begin();
+        std::advance(itr, idx);
+        return itr->first.get_value<fkyaml::detail::str_view>().data();
+    };
+
+    std::string source = "- {id: 1, name: foo}\n"
+                         "- id: 2\n"
+                         "  name: bar\n"
+                         "---\n"
+                         "[{\"id\": 3, \"name\": \"baz\"}]\n";
+    auto p_key_table = std::make_shared<fkyaml::node::key_intern_table_type>();
+
+    SECTION("keys across documents") {
+        std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs(source, p_key_table);
+        REQUIRE(docs == fkyaml::node::deserialize_docs(source));
+        REQUIRE(p_key_table->size() == 2);
+
+        const char* p_id = key_data(docs[0][0], 0);
+        const char* p_name = key_data(docs[0][0], 1);
+        REQUIRE(key_data(docs[0][1], 0) == p_id);
+        REQUIRE(key_data(docs[0][1], 1) == p_name);
+        REQUIRE(key_data(docs[1][0], 0) == p_id);
+        REQUIRE(key_data(docs[1][0], 1) == p_name);
+
+        // values are not interned.
+        REQUIRE(docs[0][0]["name"].get_value<std::string>() == "foo");
+        REQUIRE(docs[0][1]["name"].get_value<std::string>() == "bar");
+    }
+
+    SECTION("interned keys are read-only through const references") {
+        const fkyaml::node node = fkyaml::node::deserialize("id: 1", p_key_table);
+        const fkyaml::node& key = node.get_value_ref<const fkyaml::node::mapping_type&>().begin()->first;
+        const char* p_id = key_data(node, 0);
+        REQUIRE_THROWS_AS(key.get_value_ref<const std::string&>(), fkyaml::type_error);
+        REQUIRE(key.get_value<std::string>() == "id");
+        REQUIRE(key_data(node, 0) == p_id);
+    }
+
+    SECTION("keys across deserializations") {
+        fkyaml::node first = fkyaml::node::deserialize("{id: 1}", p_key_table);
+        fkyaml::node second = fkyaml::node::deserialize("id: 2", p_key_table);
+        REQUIRE(key_data(first, 0) == key_data(second, 0));
+        REQUIRE(first["id"].get_value<int>() == 1);
+        REQUIRE(second["id"].get_value<int>() == 2);
+
+        // the table is kept alive by the resulting nodes.
+        p_key_table.reset();
+        REQUIRE(first.contains("id"));
+        REQUIRE(fkyaml::node::serialize(second) == "id: 2\n");
+    }
+
+    SECTION("document streams") {
+        std::vector<fkyaml::node> docs;
+        for (auto& doc : fkyaml::node::document_stream(source, p_key_table)) {
+            docs.emplace_back(std::move(doc));
+        }
+        REQUIRE(docs == fkyaml::node::deserialize_docs(source));
+        REQUIRE(key_data(docs[0][0], 0) == key_data(docs[1][0], 0));
+    }
+
+    SECTION("keys which are not interned") {
+        auto p_small_table = std::make_shared<fkyaml::node::key_intern_table_type>(1);
+        fkyaml::node node = fkyaml::node::deserialize("a: 1\nb: 2\n&anchor c: 3\n", p_small_table);
+        REQUIRE(p_small_table->size() == 1);
+        REQUIRE(node == fkyaml::node::deserialize("a: 1\nb: 2\n&anchor c: 3\n"));
+
+        // the interned keys can be modified without affecting the others.
+        fkyaml::node other = fkyaml::node::deserialize("a: 1\n", p_small_table);
+        fkyaml::node key = node.get_value_ref<fkyaml::node::mapping_type&>().begin()->first;
+        key.get_value_ref<std::string&>() = "z";
+        REQUIRE(other.contains("a"));
+        REQUIRE(node.contains("a"));
+    }
+}
+
 TEST_CASE("Node_ExtractionOperator") {
     fkyaml::node node;
     std::ifstream ifs(FK_YAML_TEST_DATA_DIR "/extraction_operator_test_data.yml");
@@ -626,6 +918,16 @@ TEST_CASE("Node_SerializeDocs") {
     REQUIRE(fkyaml::node::serialize_docs(docs) == "foo: bar\n...\n123: true\n");
 }
 
+TEST_CASE("Node_SerializeJson") {
+    fkyaml::node node = fkyaml::node::deserialize("foo: [1, 2.5, \"bar\"]");
+    REQUIRE(fkyaml::node::serialize_json(node) == "{\"foo\":[1,2.5,\"bar\"]}");
+    REQUIRE(fkyaml::node::serialize_json(node, true) == "{\n  \"foo\": [\n    1,\n    2.5,\n    \"bar\"\n  ]\n}");
+
+    std::ostringstream oss;
+    fkyaml::node::serialize_json(node, oss);
+    REQUIRE(oss.str() == "{\"foo\":[1,2.5,\"bar\"]}");
+}
+
 TEST_CASE("Node_InsertionOperator") {
     fkyaml::node node = {{"foo", 123}, {"bar", nullptr}, {"baz", true}};
     std::stringstream ss;
@@ -2557,6 +2859,12 @@ TEST_CASE("Node_GetValue") {
             REQUIRE(str_wrap.str == "test");
         }
 
+        SECTION("str_view") {
+            auto view = node.get_value<fkyaml::detail::str_view>();
+            REQUIRE(view.size() == 4);
+            REQUIRE(view == "test");
+        }
+
 #ifdef FK_YAML_HAS_CXX_17
         SECTION("string view") {
             auto str_view = node.get_value<std::string_view>();
@@ -0,0 +1,59 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+// included first to check that the header is self-contained.
+#include <fkYAML/node_fwd.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+// declarations which only need the forward declarations, just like in user headers.
+std::size_t count_entries(const fkyaml::node& n);
+fkyaml::node& first_entry(fkyaml::node& n);
+fkyaml::node parse_with(fkyaml::parser& parser, const std::string& input);
+
+} // namespace
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace {
+
+std::size_t count_entries(const fkyaml::node& n) {
+    return n.size();
+}
+
+fkyaml::node& first_entry(fkyaml::node& n) {
+    return n[0];
+}
+
+fkyaml::node parse_with(fkyaml::parser& parser, const std::string& input) {
+    return parser.deserialize(input);
+}
+
+} // namespace
+
+TEST_CASE("NodeFwd_DefaultTemplateArguments") {
+    using default_node_type = fkyaml::basic_node<
+        std::vector, std::map, bool, std::int64_t, double, std::string, fkyaml::node_value_converter>;
+    REQUIRE(std::is_same<fkyaml::node, default_node_type>::value);
+    REQUIRE(std::is_same<fkyaml::parser, fkyaml::basic_parser<default_node_type>>::value);
+}
+
+TEST_CASE("NodeFwd_ForwardDeclaredFunctions") {
+    fkyaml::parser parser;
+    fkyaml::node n = parse_with(parser, "[foo, bar]");
+    REQUIRE(count_entries(n) == 2);
+    REQUIRE(first_entry(n).get_value<std::string>() == "foo");
+}
@@ -0,0 +1,108 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+TEST_CASE("Parser_Deserialize") {
+    fkyaml::parser parser;
+
+    SECTION("reused for YAML and JSON inputs") {
+        auto input = GENERATE(
+            std::string("foo: bar\nbaz: [1, 2, {qux: true}]\n"),
+            std::string("{\"foo\": \"bar\", \"baz\": [1, 2, {\"qux\": true}]}"),
+            std::string("- &anchor 1.5\n- *anchor\n- !!str 123\n"),
+            std::string("%YAML 1.1\n---\nfoo: |\n  literal\n  text\n"),
+            std::string("? foo\n: bar\n"),
+            std::string(""));
+
+        for (int i = 0; i < 3; ++i) {
+            REQUIRE(parser.deserialize(input) == fkyaml::node::deserialize(input));
+        }
+    }
+
+    SECTION("pair of iterators") {
+        std::string input = "foo: [1, 2]";
+        fkyaml::node node = parser.deserialize(input.begin(), input.end());
+        REQUIRE(node == fkyaml::node::deserialize(input));
+    }
+
+    SECTION("states are not carried over") {
+        fkyaml::node first = parser.deserialize("%YAML 1.1\n--- &anchor\nfoo: &bar !!str baz\n");
+        REQUIRE(first.get_yaml_version_type() == fkyaml::yaml_version_type::VERSION_1_1);
+
+        fkyaml::node second = parser.deserialize("foo: baz");
+        REQUIRE(second.get_yaml_version_type() == fkyaml::yaml_version_type::VERSION_1_2);
+        REQUIRE_FALSE(second.has_anchor_name());
+        REQUIRE_FALSE(second["foo"].has_anchor_name());
+        REQUIRE_FALSE(second["foo"].has_tag_name());
+
+        // anchors defined in the previous input must not be referenced.
+        REQUIRE_THROWS_AS(parser.deserialize("foo: *bar"), fkyaml::parse_error);
+
+        // the previous result is unaffected.
+        REQUIRE(first["foo"].get_anchor_name() == "bar");
+        REQUIRE(first["foo"].get_value<std::string>() == "baz");
+    }
+
+    SECTION("reused after errors") {
+        auto input = GENERATE(
+            std::string("foo:\n  - [1, {bar: *baz}]\n"),
+            std::string("{\"foo\": [1, {\"bar\": \"baz"),
+            std::string("foo: bar: baz"));
+        REQUIRE_THROWS_AS(parser.deserialize(input), fkyaml::parse_error);
+
+        fkyaml::node node = parser.deserialize("foo: [1, {bar: baz}]");
+        REQUIRE(node == fkyaml::node::deserialize("foo: [1, {bar: baz}]"));
+    }
+}
+
+TEST_CASE("Parser_DeserializeDocs") {
+    fkyaml::parser parser;
+    std::string input = "foo: 1\n---\n[2, 3]\n---\n\"baz\"\n";
+
+    for (int i = 0; i < 3; ++i) {
+        std::vector<fkyaml::node> docs = parser.deserialize_docs(input);
+        REQUIRE(docs == fkyaml::node::deserialize_docs(input));
+    }
+
+    std::vector<fkyaml::node> docs = parser.deserialize_docs(input.begin(), input.end());
+    REQUIRE(docs == fkyaml::node::deserialize_docs(input));
+
+    // single documents can be deserialized by the same parser afterwards.
+    REQUIRE(parser.deserialize(input) == fkyaml::node::deserialize(input));
+}
+
+TEST_CASE("Parser_KeyInternTable") {
+    auto p_key_table = std::make_shared<fkyaml::parser::key_intern_table_type>();
+    fkyaml::parser parser(p_key_table);
+
+    fkyaml::node first = parser.deserialize("id: 1\nname: foo\n");
+    fkyaml::node second = parser.deserialize("{\"id\": 2, \"name\": \"bar\"}");
+    REQUIRE(p_key_table->size() == 2);
+
+    auto first_key_data = [](const fkyaml::node& map) {
+        const auto& key = map.get_value_ref<const fkyaml::node::mapping_type&>().begin()->first;
+        return key.get_value<fkyaml::detail::str_view>().data();
+    };
+    REQUIRE(first_key_data(first) == first_key_data(second));
+    REQUIRE(second["name"].get_value<std::string>() == "bar");
+}
+
+TEST_CASE("Parser_MoveCtor") {
+    fkyaml::parser parser;
+    REQUIRE(parser.deserialize("foo: bar").contains("foo"));
+
+    fkyaml::parser moved(std::move(parser));
+    REQUIRE(moved.deserialize("[1, 2]").size() == 2);
+}
@@ -7,6 +7,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <cfloat>
+#include <cstdint>
 #include <string>
 #include <utility>
 
@@ -366,6 +367,53 @@ TEST_CASE("ScalarConv_atoi_uint64_t") {
     }
 }
 
+TEST_CASE("ScalarConv_atoi_EightDigitsAtATime") {
+    SECTION("is_8_decimal_digits()") {
+        REQUIRE(fkyaml::detail::is_8_decimal_digits(fkyaml::detail::load_8_chars("01234567")));
+        REQUIRE(fkyaml::detail::is_8_decimal_digits(fkyaml::detail::load_8_chars("99999999")));
+
+        auto input = GENERATE(
+            std::string("0123456/"),
+            std::string(":1234567"),
+            std::string("0123a567"),
+            std::string("012 4567"),
+            std::string("0123456\xB9"));
+        REQUIRE_FALSE(fkyaml::detail::is_8_decimal_digits(fkyaml::detail::load_8_chars(input.c_str())));
+    }
+
+    SECTION("parse_8_decimal_digits()") {
+        REQUIRE(fkyaml::detail::parse_8_decimal_digits(fkyaml::detail::load_8_chars("00000000")) == 0u);
+        REQUIRE(fkyaml::detail::parse_8_decimal_digits(fkyaml::detail::load_8_chars("12345678")) == 12345678u);
+        REQUIRE(fkyaml::detail::parse_8_decimal_digits(fkyaml::detail::load_8_chars("99999999")) == 99999999u);
+    }
+
+    SECTION("valid values") {
+        using test_data_t = std::pair<std::string, int64_t>;
+        auto test_data = GENERATE(
+            test_data_t("12345678", 12345678),
+            test_data_t("-123456789", -123456789),
+            test_data_t("+1234567890123456", 1234567890123456),
+            test_data_t("+00000000000000042", 42),
+            test_data_t("-1000000000000000000", -1000000000000000000));
+
+        int64_t integer = 0;
+        REQUIRE(fkyaml::detail::atoi(test_data.first.begin(), test_data.first.end(), integer) == true);
+        REQUIRE(integer == test_data.second);
+    }
+
+    SECTION("non-digit characters") {
+        auto input = GENERATE(
+            std::string("1234567a"),
+            std::string("123456789/"),
+            std::string("12345678:0"),
+            std::string("-12 4567890"),
+            std::string("+123456789012345x"));
+
+        int64_t integer = 0;
+        REQUIRE(fkyaml::detail::atoi(input.begin(), input.end(), integer) == false);
+    }
+}
+
 TEST_CASE("ScalarConv_atof_float") {
     float fp = 0.f;
     using limits_type = std::numeric_limits<float>;
@@ -6,6 +6,8 @@
 // SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
 // SPDX-License-Identifier: MIT
 
+#include <cstdint>
+
 #include <catch2/catch.hpp>
 
 #include <fkYAML/node.hpp>
@@ -112,6 +114,22 @@ TEST_CASE("ScalarParser_FlowPlainScalar_integer") {
         REQUIRE(node.is_integer());
         REQUIRE(node.get_value<int>() == test_data.second);
     }
+
+    SECTION("boundary values") {
+        REQUIRE_NOTHROW(node = scalar_parser.parse_flow(lex_type, tag_type, "9223372036854775807"));
+        REQUIRE(node.get_value<int64_t>() == INT64_MAX);
+        REQUIRE_NOTHROW(node = scalar_parser.parse_flow(lex_type, tag_type, "-9223372036854775808"));
+        REQUIRE(node.get_value<int64_t>() == INT64_MIN);
+    }
+
+    SECTION("out of range values") {
+        auto token = GENERATE(
+            fkyaml::detail::str_view("9223372036854775808"),
+            fkyaml::detail::str_view("-9223372036854775809"),
+            fkyaml::detail::str_view("12345678901234567890123"));
+
+        REQUIRE_THROWS_AS(scalar_parser.parse_flow(lex_type, tag_type, token), fkyaml::parse_error);
+    }
 }
 
 TEST_CASE("ScalarParser_FlowPlainScalar_float") {
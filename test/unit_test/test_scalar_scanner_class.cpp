@@ -6,6 +6,9 @@
 // SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
 // SPDX-License-Identifier: MIT
 
+#include <cstdint>
+#include <utility>
+
 #include <catch2/catch.hpp>
 
 #include <fkYAML/node.hpp>
@@ -136,3 +139,87 @@ TEST_CASE("ScalarScanner_StringValue") {
         fkyaml::detail::str_view("0xyz"));
     REQUIRE(fkyaml::detail::scalar_scanner::scan(token.begin(), token.end()) == fkyaml::node_type::STRING);
 }
+
+TEST_CASE("ScalarScanner_ScanAndConvert") {
+    using scanned_number_type = fkyaml::detail::scanned_number<int64_t, double>;
+
+    SECTION("decimal integers") {
+        using test_data_t = std::pair<fkyaml::detail::str_view, int64_t>;
+        auto test_data = GENERATE(
+            test_data_t("0", 0),
+            test_data_t("-0", 0),
+            test_data_t("643", 643),
+            test_data_t("+120", 120),
+            test_data_t("-00123", -123),
+            test_data_t("9223372036854775807", INT64_MAX),
+            test_data_t("-9223372036854775808", INT64_MIN));
+
+        scanned_number_type number {};
+        fkyaml::detail::str_view token = test_data.first;
+        REQUIRE(fkyaml::detail::scalar_scanner::scan(token.begin(), token.end(), number) == fkyaml::node_type::INTEGER);
+        REQUIRE(number.is_converted);
+        REQUIRE(number.integer == test_data.second);
+    }
+
+    SECTION("decimal floating point values") {
+        using test_data_t = std::pair<fkyaml::detail::str_view, double>;
+        auto test_data = GENERATE(
+            test_data_t("0.", 0.),
+            test_data_t("-1.234", -1.234),
+            test_data_t("+.123", .123),
+            test_data_t("567.8", 567.8),
+            test_data_t("0e1", 0.),
+            test_data_t("1.e3", 1.e3),
+            test_data_t("-.1e-3", -.1e-3),
+            test_data_t("3.95E3", 3.95E3),
+            test_data_t("9007199254740992.", 9007199254740992.),
+            test_data_t("1e22", 1e22),
+            test_data_t("1e23", 1e23),
+            test_data_t("9007199254740993.0", 9007199254740992.),
+            test_data_t("2.2250738585072011e-308", 2.2250738585072011e-308));
+
+        scanned_number_type number {};
+        fkyaml::detail::str_view token = test_data.first;
+        REQUIRE(fkyaml::detail::scalar_scanner::scan(token.begin(), token.end(), number) == fkyaml::node_type::FLOAT);
+        REQUIRE(number.is_converted);
+        REQUIRE(number.float_number == test_data.second);
+    }
+
+    SECTION("numbers left unconverted") {
+        using test_data_t = std::pair<fkyaml::detail::str_view, fkyaml::node_type>;
+        auto test_data = GENERATE(
+            test_data_t("0o27", fkyaml::node_type::INTEGER),
+            test_data_t("0xA04F", fkyaml::node_type::INTEGER),
+            test_data_t("9223372036854775808", fkyaml::node_type::INTEGER),
+            test_data_t("12345678901234567890", fkyaml::node_type::INTEGER),
+            test_data_t(".inf", fkyaml::node_type::FLOAT),
+            test_data_t("-.inf", fkyaml::node_type::FLOAT),
+            test_data_t(".nan", fkyaml::node_type::FLOAT),
+            test_data_t("1e400", fkyaml::node_type::FLOAT),
+            test_data_t("-1e-400", fkyaml::node_type::FLOAT),
+            test_data_t("1.2345678901234567890", fkyaml::node_type::FLOAT));
+
+        scanned_number_type number {};
+        fkyaml::detail::str_view token = test_data.first;
+        REQUIRE(fkyaml::detail::scalar_scanner::scan(token.begin(), token.end(), number) == test_data.second);
+        REQUIRE_FALSE(number.is_converted);
+    }
+
+    SECTION("non-numbers") {
+        auto test_data = GENERATE(
+            std::make_pair(fkyaml::detail::str_view(""), fkyaml::node_type::STRING),
+            std::make_pair(fkyaml::detail::str_view("~"), fkyaml::node_type::NULL_OBJECT),
+            std::make_pair(fkyaml::detail::str_view("true"), fkyaml::node_type::BOOLEAN),
+            std::make_pair(fkyaml::detail::str_view("-"), fkyaml::node_type::STRING),
+            std::make_pair(fkyaml::detail::str_view("-."), fkyaml::node_type::STRING),
+            std::make_pair(fkyaml::detail::str_view("0123"), fkyaml::node_type::STRING),
+            std::make_pair(fkyaml::detail::str_view("1.2.3"), fkyaml::node_type::STRING),
+            std::make_pair(fkyaml::detail::str_view("1.23e"), fkyaml::node_type::STRING),
+            std::make_pair(fkyaml::detail::str_view("1_000"), fkyaml::node_type::STRING));
+
+        scanned_number_type number {};
+        fkyaml::detail::str_view token = test_data.first;
+        REQUIRE(fkyaml::detail::scalar_scanner::scan(token.begin(), token.end(), number) == test_data.second);
+        REQUIRE_FALSE(number.is_converted);
+    }
+}
@@ -0,0 +1,240 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <fkYAML/node.hpp>
+
+namespace test {
+
+struct point {
+    int x;
+    int y;
+};
+
+FK_YAML_DEFINE_TYPE(point, x, y)
+
+inline bool operator==(const point& lhs, const point& rhs) {
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+struct shape {
+    std::string name;
+    std::vector<point> points;
+    double scale;
+    bool is_closed;
+};
+
+FK_YAML_DEFINE_TYPE(shape, name, points, scale, is_closed)
+
+inline bool operator==(const shape& lhs, const shape& rhs) {
+    return lhs.name == rhs.name && lhs.points == rhs.points && lhs.scale == rhs.scale &&
+           lhs.is_closed == rhs.is_closed;
+}
+
+} // namespace test
+
+template <typename T>
+static bool decode(const std::string& input, T& value) {
+    fkyaml::detail::typed_decoder<fkyaml::node> decoder {};
+    return decoder.decode(fkyaml::detail::str_view(input), value);
+}
+
+// checks that the input is decoded without YAML nodes into the same value as the one converted from YAML nodes.
+template <typename T>
+static void require_decoded(const std::string& input) {
+    T value {};
+    REQUIRE(decode(input, value));
+    REQUIRE(value == fkyaml::node::deserialize(input).get_value<T>());
+    REQUIRE(fkyaml::node::deserialize_into<T>(input) == value);
+}
+
+// checks that the input is left to YAML nodes and converted into the same value.
+template <typename T>
+static void require_fallback(const std::string& input) {
+    T value {};
+    REQUIRE_FALSE(decode(input, value));
+    REQUIRE(fkyaml::node::deserialize_into<T>(input) == fkyaml::node::deserialize(input).get_value<T>());
+}
+
+TEST_CASE("TypedDecoder_Scalars") {
+    SECTION("strings") {
+        auto input = GENERATE(
+            std::string("foo"),
+            std::string("foo bar\n"),
+            std::string("'foo''s'"),
+            std::string("\"foo\\tbar\\u00e9\""),
+            std::string("--- foo\n"),
+            std::string("---\nfoo\n...\n"),
+            std::string("|\n  foo\n  bar\n"),
+            std::string(">-\n  foo\n  bar\n"),
+            std::string("# comment\nfoo # comment\n"));
+        require_decoded<std::string>(input);
+    }
+
+    SECTION("integers") {
+        auto input = GENERATE(std::string("0"), std::string("-123"), std::string("0x1F"), std::string("0o17"));
+        require_decoded<int>(input);
+        require_decoded<int64_t>(input);
+    }
+
+    SECTION("floating point values") {
+        auto input = GENERATE(std::string("3.14"), std::string("-1e-3"), std::string(".inf"));
+        require_decoded<double>(input);
+    }
+
+    SECTION("booleans") {
+        auto input = GENERATE(std::string("true"), std::string("False"));
+        require_decoded<bool>(input);
+    }
+}
+
+TEST_CASE("TypedDecoder_Sequences") {
+    SECTION("block and flow sequences") {
+        auto input = GENERATE(
+            std::string("[1, 2, 3]"),
+            std::string("[1, 2, 3,]"),
+            std::string("[]"),
+            std::string("[\n  1,\n  2\n]\n"),
+            std::string("- 1\n- 2\n- 3\n"),
+            std::string("  - 1\n  - 2\n"),
+            std::string("---\n- 1\n- 2\n"),
+            std::string("- 1\n# comment\n- 2\n"));
+        require_decoded<std::vector<int>>(input);
+    }
+
+    SECTION("nested sequences") {
+        auto input = GENERATE(
+            std::string("[[1, 2], [], [3]]"),
+            std::string("- [1, 2]\n- []\n- [3]\n"),
+            std::string("- - 1\n  - 2\n- - 3\n"),
+            std::string("-\n  - 1\n  - 2\n- [3]\n"));
+        require_decoded<std::vector<std::vector<int>>>(input);
+    }
+
+    SECTION("sequences of strings") {
+        auto input = GENERATE(
+            std::string("[foo, 'bar', \"baz\"]"),
+            std::string("- foo\n- |\n  bar\n- >\n  baz\n"),
+            std::string("[\"a\\\"b\", 'c''d']"));
+        require_decoded<std::vector<std::string>>(input);
+    }
+}
+
+TEST_CASE("TypedDecoder_Mappings") {
+    SECTION("mappings of sequences") {
+        using map_type = std::map<std::string, std::vector<int>>;
+        auto input = GENERATE(
+            std::string("foo: [1, 2]\nbar: []\n"),
+            std::string("foo:\n  - 1\n  - 2\nbar: [3]\n"),
+            std::string("foo:\n- 1\n- 2\nbar:\n- 3\n"),
+            std::string("{foo: [1, 2], \"bar\": [3]}"),
+            std::string("{\"foo\": [1, 2], \"bar\": [3]}"),
+            std::string("'foo': [1]\n\"bar\": [2]\n"),
+            std::string("\"f\\x6fo\": [1]\n"));
+        require_decoded<map_type>(input);
+    }
+
+    SECTION("nested mappings") {
+        using map_type = std::map<std::string, std::map<std::string, int>>;
+        auto input = GENERATE(
+            std::string("foo:\n  a: 1\n  b: 2\nbar: {c: 3}\n"),
+            std::string("foo: {a: 1, b: 2}\nbar: {}\n"),
+            std::string("  foo:\n    a: 1\n  bar:\n    b: 2\n"));
+        require_decoded<map_type>(input);
+    }
+
+    SECTION("mappings with non-string keys") {
+        auto input = GENERATE(std::string("1: foo\n2: bar\n"), std::string("{1: foo, 0x2: bar}"));
+        require_decoded<std::map<int, std::string>>(input);
+    }
+}
+
+TEST_CASE("TypedDecoder_UserDefinedTypes") {
+    SECTION("fields in any order") {
+        auto input = GENERATE(
+            std::string("x: 1\ny: 2\n"),
+            std::string("y: 2\nx: 1\n"),
+            std::string("{x: 1, y: 2}"),
+            std::string("{\"y\": 2, \"x\": 1}"));
+        require_decoded<test::point>(input);
+    }
+
+    SECTION("unknown keys with any values") {
+        auto input = GENERATE(
+            std::string("x: 1\nz: [1, {a: b}, [c]]\ny: 2\n"),
+            std::string("x: 1\nz:\n  a:\n    - b\n    - c: d\n  e: |\n    f\ny: 2\n"),
+            std::string("w:\nx: 1\nz: ~\ny: 2\n"),
+            std::string("x: 1\nz:\n  -\n  - a\ny: 2\n"));
+        require_decoded<test::point>(input);
+    }
+
+    SECTION("nested user-defined types") {
+        auto input = GENERATE(
+            std::string("name: foo\npoints:\n  - x: 1\n    y: 2\n  - {x: 3, y: 4}\nscale: 1.5\nis_closed: true\n"),
+            std::string("name: foo\npoints:\n- y: 2\n  x: 1\nscale: 2.0\nis_closed: false\n"),
+            std::string("{name: foo, points: [{x: 1, y: 2}], scale: .5, is_closed: true}"));
+        require_decoded<test::shape>(input);
+    }
+
+    SECTION("sequences of user-defined types") {
+        auto input = GENERATE(std::string("- x: 1\n  y: 2\n- {x: 3, y: 4}\n"), std::string("[{x: 1, y: 2}]"));
+        require_decoded<std::vector<test::point>>(input);
+    }
+}
+
+TEST_CASE("TypedDecoder_Fallback") {
+    SECTION("inputs which are valid but not supported") {
+        require_fallback<std::string>("%YAML 1.2\n---\nfoo\n");
+        require_fallback<std::string>("!!str 123\n");
+        require_fallback<std::vector<int>>("- &anchor 1\n- *anchor\n");
+        require_fallback<std::map<std::string, int>>("? foo\n: 1\n");
+        require_fallback<std::string>("foo\n  bar\n");
+        require_fallback<std::vector<int>>("- 1\n-\n");
+        require_fallback<test::point>("x: 1\ny: 2\n\"\\u007A\": 3\n");
+    }
+
+    SECTION("inputs which are converted differently") {
+        // a missing field is reported with the same exception as the conversion from YAML nodes.
+        REQUIRE_FALSE([]() {
+            test::point value {};
+            return decode("x: 1\n", value);
+        }());
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_into<test::point>("x: 1\n"), fkyaml::out_of_range);
+
+        // a null value cannot be converted into a string.
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_into<std::string>(""), fkyaml::type_error);
+
+        // scalars of different types.
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_into<std::vector<int>>("[1, foo]"), fkyaml::type_error);
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_into<std::string>("123"), fkyaml::type_error);
+    }
+
+    SECTION("invalid inputs") {
+        auto input = GENERATE(
+            std::string("[1, 2]]"),
+            std::string("[1, 2}"),
+            std::string("x: 1\nx: 2\n"),
+            std::string("{x: 1, x: 2}"),
+            std::string("x: [1, 2}\n"),
+            std::string("x: 1 y: 2\n"));
+
+        std::vector<int> seq {};
+        REQUIRE_FALSE(decode(input, seq));
+        test::point point {};
+        REQUIRE_FALSE(decode(input, point));
+
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize(input), fkyaml::exception);
+        REQUIRE_THROWS_AS(fkyaml::node::deserialize_into<test::point>(input), fkyaml::exception);
+    }
+}
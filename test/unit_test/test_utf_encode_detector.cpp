@@ -7,6 +7,8 @@
 // SPDX-License-Identifier: MIT
 
 #include <fstream>
+#include <sstream>
+#include <string>
 
 #include <catch2/catch.hpp>
 
@@ -598,3 +600,61 @@ TEST_CASE("UTFEncodeDetector_DetectEncodingAndSkipBom") {
         REQUIRE(ifs.tellg() == 0);
     }
 }
+
+TEST_CASE("UTFEncodeDetector_DetectEncodingWithoutSeek") {
+    SECTION("std::istream with UTF-8 encoding") {
+        std::istringstream iss("abcde");
+        std::string leading_bytes {};
+        fkyaml::detail::utf_encode_t ret = fkyaml::detail::stream_utf_encode_detector::detect(iss, leading_bytes);
+        REQUIRE(ret == fkyaml::detail::utf_encode_t::UTF_8);
+        REQUIRE(leading_bytes == "abcd");
+    }
+
+    SECTION("std::istream with UTF-8(BOM) encoding") {
+        std::istringstream iss("\xEF\xBB\xBF"
+                               "ab");
+        std::string leading_bytes {};
+        fkyaml::detail::utf_encode_t ret = fkyaml::detail::stream_utf_encode_detector::detect(iss, leading_bytes);
+        REQUIRE(ret == fkyaml::detail::utf_encode_t::UTF_8);
+        REQUIRE(leading_bytes == "a");
+    }
+
+    SECTION("std::istream with UTF-16BE(BOM) encoding") {
+        std::istringstream iss(std::string {char(0xFEu), char(0xFFu), 0, 0x61});
+        std::string leading_bytes {};
+        fkyaml::detail::utf_encode_t ret = fkyaml::detail::stream_utf_encode_detector::detect(iss, leading_bytes);
+        REQUIRE(ret == fkyaml::detail::utf_encode_t::UTF_16BE);
+        REQUIRE(leading_bytes == std::string {0, 0x61});
+    }
+
+    SECTION("std::istream with UTF-32LE encoding") {
+        std::istringstream iss(std::string {0x61, 0, 0, 0});
+        std::string leading_bytes {};
+        fkyaml::detail::utf_encode_t ret = fkyaml::detail::stream_utf_encode_detector::detect(iss, leading_bytes);
+        REQUIRE(ret == fkyaml::detail::utf_encode_t::UTF_32LE);
+        REQUIRE(leading_bytes == std::string {0x61, 0, 0, 0});
+    }
+
+    SECTION("std::istream with an empty input") {
+        std::istringstream iss("");
+        std::string leading_bytes {};
+        fkyaml::detail::utf_encode_t ret = fkyaml::detail::stream_utf_encode_detector::detect(iss, leading_bytes);
+        REQUIRE(ret == fkyaml::detail::utf_encode_t::UTF_8);
+        REQUIRE(leading_bytes.empty());
+    }
+
+    SECTION("FILE* object with UTF-8(BOM) encoding") {
+        DISABLE_C4996
+        std::FILE* p_file = std::fopen(FK_YAML_TEST_DATA_DIR "/input_adapter_test_data_utf8bom.txt", "r");
+        ENABLE_C4996
+
+        REQUIRE(p_file != nullptr);
+        std::string leading_bytes {};
+        fkyaml::detail::utf_encode_t ret = fkyaml::detail::file_utf_encode_detector::detect(p_file, leading_bytes);
+        REQUIRE(ret == fkyaml::detail::utf_encode_t::UTF_8);
+        REQUIRE(leading_bytes.size() == 1);
+        REQUIRE(std::ftell(p_file) == 4);
+
+        std::fclose(p_file);
+    }
+}
@@ -0,0 +1,377 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifdef _MSC_VER
+// suppress the C4996 warning against the usage of fopen().
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <fkYAML/node.hpp>
+
+//
+// Counting hooks for the global allocation functions.
+// Every allocation is prefixed with a header which holds its size so that the live bytes can be tracked on
+// deallocation as well. Benchmarks are run on a single thread, and so are the counters updated.
+//
+
+namespace {
+
+/// @brief Allocation statistics of this process.
+struct alloc_stats {
+    /// The number of allocations.
+    uint64_t num_allocs {0};
+    /// The number of deallocations.
+    uint64_t num_frees {0};
+    /// The total bytes allocated.
+    uint64_t alloc_bytes {0};
+    /// The bytes currently allocated.
+    uint64_t live_bytes {0};
+    /// The peak of live_bytes since the last reset.
+    uint64_t peak_live_bytes {0};
+};
+
+alloc_stats g_stats {};
+
+/// The size of the header of each allocation, which keeps the alignment for any fundamental type.
+constexpr std::size_t header_size = (sizeof(std::size_t) + alignof(std::max_align_t) - 1) /
+                                    alignof(std::max_align_t) * alignof(std::max_align_t);
+
+void* counting_alloc(std::size_t size) {
+    void* p = std::malloc(header_size + size);
+    if (!p) {
+        return nullptr;
+    }
+
+    *static_cast<std::size_t*>(p) = size;
+    ++g_stats.num_allocs;
+    g_stats.alloc_bytes += size;
+    g_stats.live_bytes += size;
+    g_stats.peak_live_bytes = std::max(g_stats.peak_live_bytes, g_stats.live_bytes);
+    return static_cast<char*>(p) + header_size;
+}
+
+void counting_free(void* p) noexcept {
+    if (!p) {
+        return;
+    }
+
+    void* p_head = static_cast<char*>(p) - header_size;
+    ++g_stats.num_frees;
+    g_stats.live_bytes -= *static_cast<std::size_t*>(p_head);
+    std::free(p_head);
+}
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    void* p = counting_alloc(size);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return counting_alloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return counting_alloc(size);
+}
+
+void operator delete(void* p) noexcept {
+    counting_free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    counting_free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    counting_free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    counting_free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    counting_free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    counting_free(p);
+}
+
+/// @brief A recorder of allocation statistics of measured regions in benchmark iterations.
+class alloc_recorder {
+public:
+    /// @brief Start a measured region.
+    void begin() noexcept {
+        m_begin = g_stats;
+        g_stats.peak_live_bytes = g_stats.live_bytes;
+    }
+
+    /// @brief Finish the current measured region.
+    void end() noexcept {
+        m_num_allocs += g_stats.num_allocs - m_begin.num_allocs;
+        m_num_frees += g_stats.num_frees - m_begin.num_frees;
+        m_alloc_bytes += g_stats.alloc_bytes - m_begin.alloc_bytes;
+        m_peak_live_bytes = std::max(m_peak_live_bytes, g_stats.peak_live_bytes - m_begin.live_bytes);
+    }
+
+    /// @brief Report the recorded statistics as per-iteration counters.
+    /// @param st The state of the benchmark.
+    void report(benchmark::State& st) const {
+        st.counters["allocs"] =
+            benchmark::Counter(static_cast<double>(m_num_allocs), benchmark::Counter::kAvgIterations);
+        st.counters["frees"] = benchmark::Counter(static_cast<double>(m_num_frees), benchmark::Counter::kAvgIterations);
+        st.counters["alloc_bytes"] = benchmark::Counter(
+            static_cast<double>(m_alloc_bytes), benchmark::Counter::kAvgIterations, benchmark::Counter::kIs1024);
+        st.counters["peak_live_bytes"] = benchmark::Counter(
+            static_cast<double>(m_peak_live_bytes), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    }
+
+private:
+    /// The statistics at the beginning of the current region.
+    alloc_stats m_begin {};
+    /// The number of allocations in the measured regions.
+    uint64_t m_num_allocs {0};
+    /// The number of deallocations in the measured regions.
+    uint64_t m_num_frees {0};
+    /// The total bytes allocated in the measured regions.
+    uint64_t m_alloc_bytes {0};
+    /// The maximum peak of live bytes in a measured region relative to its beginning.
+    uint64_t m_peak_live_bytes {0};
+};
+
+static std::string test_src {};
+
+void prepare_test_source(char* filename) {
+    FILE* fp = std::fopen(filename, "rb");
+    char tmp_buf[256] {};
+    std::size_t buf_size = sizeof(tmp_buf) / sizeof(char);
+    std::size_t read_size = 0;
+    while ((read_size = std::fread(&tmp_buf[0], sizeof(char), buf_size, fp)) > 0) {
+        test_src.append(tmp_buf, tmp_buf + read_size);
+    }
+    std::fclose(fp);
+    fp = nullptr;
+}
+
+int main(int argc, char** argv) {
+    prepare_test_source(argv[1]);
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
+
+//
+// Benchmarking functions.
+// Only the operation of each benchmark is measured, e.g., freeing the resulting nodes is not counted in parsing.
+//
+
+void bm_fkyaml_alloc_parse(benchmark::State& st) {
+    alloc_recorder recorder;
+
+    for (auto _ : st) {
+        recorder.begin();
+        fkyaml::node n = fkyaml::node::deserialize(test_src);
+        recorder.end();
+    }
+
+    recorder.report(st);
+    st.SetBytesProcessed(st.iterations() * test_src.size());
+}
+
+void bm_fkyaml_alloc_parse_reused_parser(benchmark::State& st) {
+    alloc_recorder recorder;
+    fkyaml::parser parser;
+
+    for (auto _ : st) {
+        recorder.begin();
+        fkyaml::node n = parser.deserialize(test_src);
+        recorder.end();
+    }
+
+    recorder.report(st);
+    st.SetBytesProcessed(st.iterations() * test_src.size());
+}
+
+void bm_fkyaml_alloc_serialize(benchmark::State& st) {
+    alloc_recorder recorder;
+    fkyaml::node n = fkyaml::node::deserialize(test_src);
+
+    for (auto _ : st) {
+        recorder.begin();
+        std::string out = fkyaml::node::serialize(n);
+        recorder.end();
+    }
+
+    recorder.report(st);
+}
+
+void bm_fkyaml_alloc_insertion_operator(benchmark::State& st) {
+    alloc_recorder recorder;
+    fkyaml::node n = fkyaml::node::deserialize(test_src);
+
+    for (auto _ : st) {
+        recorder.begin();
+        std::ostringstream oss;
+        oss << n;
+        recorder.end();
+    }
+
+    recorder.report(st);
+}
+
+void bm_fkyaml_alloc_copy(benchmark::State& st) {
+    alloc_recorder recorder;
+    fkyaml::node n = fkyaml::node::deserialize(test_src);
+
+    for (auto _ : st) {
+        recorder.begin();
+        fkyaml::node copy = n;
+        recorder.end();
+    }
+
+    recorder.report(st);
+}
+
+void bm_fkyaml_alloc_destruction(benchmark::State& st) {
+    alloc_recorder recorder;
+    fkyaml::node n = fkyaml::node::deserialize(test_src);
+    std::vector<fkyaml::node> copies;
+    copies.reserve(1);
+
+    for (auto _ : st) {
+        st.PauseTiming();
+        copies.push_back(n);
+        st.ResumeTiming();
+
+        recorder.begin();
+        copies.clear();
+        recorder.end();
+    }
+
+    recorder.report(st);
+}
+
+/// @brief Convert all the scalars in the given node into their native types, and sequences into std::vector objects.
+/// @param n A node to be converted.
+void convert_values(const fkyaml::node& n) {
+    switch (n.get_type()) {
+    case fkyaml::node_type::SEQUENCE: {
+        std::vector<fkyaml::node> seq = n.get_value<std::vector<fkyaml::node>>();
+        for (const auto& elem : seq) {
+            convert_values(elem);
+        }
+        break;
+    }
+    case fkyaml::node_type::MAPPING:
+        for (const auto& pair : n.get_value_ref<const fkyaml::node::mapping_type&>()) {
+            convert_values(pair.first);
+            convert_values(pair.second);
+        }
+        break;
+    case fkyaml::node_type::BOOLEAN: {
+        bool value = n.get_value<bool>();
+        benchmark::DoNotOptimize(value);
+        break;
+    }
+    case fkyaml::node_type::INTEGER: {
+        int64_t value = n.get_value<int64_t>();
+        benchmark::DoNotOptimize(value);
+        break;
+    }
+    case fkyaml::node_type::FLOAT: {
+        double value = n.get_value<double>();
+        benchmark::DoNotOptimize(value);
+        break;
+    }
+    case fkyaml::node_type::STRING: {
+        std::string value = n.get_value<std::string>();
+        benchmark::DoNotOptimize(value);
+        break;
+    }
+    case fkyaml::node_type::NULL_OBJECT:
+    default:
+        break;
+    }
+}
+
+void bm_fkyaml_alloc_get_value(benchmark::State& st) {
+    alloc_recorder recorder;
+    fkyaml::node n = fkyaml::node::deserialize(test_src);
+
+    for (auto _ : st) {
+        recorder.begin();
+        convert_values(n);
+        recorder.end();
+    }
+
+    recorder.report(st);
+}
+
+void bm_fkyaml_memory_usage(benchmark::State& st) {
+    // the bytes retained on the heap by the resulting nodes, to be compared with the estimation.
+    uint64_t live_bytes = g_stats.live_bytes;
+    fkyaml::node n = fkyaml::node::deserialize(test_src);
+    uint64_t retained_bytes = g_stats.live_bytes - live_bytes;
+
+    fkyaml::node_memory_usage usage {};
+    for (auto _ : st) {
+        usage = fkyaml::memory_usage(n);
+        benchmark::DoNotOptimize(usage);
+    }
+
+    const std::pair<const char*, std::size_t> categories[] = {
+        {"node_bytes", usage.node_bytes},
+        {"container_bytes", usage.container_bytes},
+        {"string_bytes", usage.string_bytes},
+        {"slack_bytes", usage.slack_bytes},
+        {"metainfo_bytes", usage.metainfo_bytes},
+        {"anchor_table_bytes", usage.anchor_table_bytes},
+        {"total_bytes", usage.total()},
+        {"retained_bytes", static_cast<std::size_t>(retained_bytes)},
+    };
+    for (const auto& category : categories) {
+        st.counters[category.first] = benchmark::Counter(
+            static_cast<double>(category.second), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    }
+}
+
+// Register benchmarking functions.
+BENCHMARK(bm_fkyaml_alloc_parse);
+BENCHMARK(bm_fkyaml_alloc_parse_reused_parser);
+BENCHMARK(bm_fkyaml_alloc_serialize);
+BENCHMARK(bm_fkyaml_alloc_insertion_operator);
+BENCHMARK(bm_fkyaml_alloc_copy);
+BENCHMARK(bm_fkyaml_alloc_destruction);
+BENCHMARK(bm_fkyaml_alloc_get_value);
+BENCHMARK(bm_fkyaml_memory_usage);
@@ -0,0 +1,250 @@
+#!/usr/bin/env python3
+
+# Compares benchmark results in the JSON format of the Google Benchmark library against a baseline and reports
+# regressions for each benchmark and each metric (the real/CPU times and the user counters).
+# Benchmarks and metrics which fail or are missing in the contender results are reported as failures as well.
+# Only the Python standard library is required.
+
+import argparse
+import json
+import math
+import re
+import sys
+
+# keys of a benchmark entry which are not metrics.
+NON_METRIC_KEYS = {
+    'name', 'family_index', 'per_family_instance_index', 'run_name', 'run_type', 'repetitions', 'repetition_index',
+    'threads', 'iterations', 'time_unit', 'aggregate_name', 'aggregate_unit', 'error_occurred', 'error_message',
+    'label',
+}
+
+# multipliers to convert times into nanoseconds.
+TIME_UNITS = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+
+
+def load_samples(path):
+    """Load per-repetition samples of each metric of each benchmark from a JSON result file.
+
+    Returns a tuple of a dict of {run_name: {metric: [values]}} in the order of appearance and a dict of
+    {run_name: error message} for benchmarks which failed in any repetition.
+    """
+    with open(path) as f:
+        results = json.load(f)
+
+    samples = {}
+    errors = {}
+    for bm in results.get('benchmarks', []):
+        # aggregates (mean, median, ...) are computed here from the iteration runs.
+        if bm.get('run_type', 'iteration') != 'iteration':
+            continue
+
+        name = bm.get('run_name', bm['name'])
+        if bm.get('error_occurred', False):
+            errors.setdefault(name, bm.get('error_message', 'unknown error'))
+            continue
+
+        metrics = samples.setdefault(name, {})
+        unit = TIME_UNITS.get(bm.get('time_unit', 'ns'), 1.0)
+        for key, value in bm.items():
+            if key in NON_METRIC_KEYS or not isinstance(value, (int, float)):
+                continue
+            if key in ('real_time', 'cpu_time'):
+                value *= unit
+            metrics.setdefault(key, []).append(float(value))
+    return samples, errors
+
+
+def higher_is_better(metric):
+    """Whether a larger value of the metric means better performance, e.g., bytes_per_second."""
+    return metric.endswith('_per_second')
+
+
+def is_timing_metric(metric):
+    """Whether the metric is a time or a rate derived from times, which varies from run to run."""
+    return metric in ('real_time', 'cpu_time') or higher_is_better(metric)
+
+
+def median(values):
+    s = sorted(values)
+    n = len(s)
+    return s[n // 2] if n % 2 == 1 else (s[n // 2 - 1] + s[n // 2]) / 2.0
+
+
+def mann_whitney_u_test(xs, ys):
+    """Two-sided Mann-Whitney U test with the normal approximation and the tie correction.
+
+    Returns the p-value, or None if the samples are too few for the test.
+    """
+    n1, n2 = len(xs), len(ys)
+    if n1 < 3 or n2 < 3:
+        return None
+
+    # assign average ranks to tied values.
+    combined = sorted([(v, 0) for v in xs] + [(v, 1) for v in ys])
+    ranks = [0.0] * len(combined)
+    tie_term = 0.0
+    i = 0
+    while i < len(combined):
+        j = i
+        while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        t = j - i + 1
+        tie_term += t ** 3 - t
+        i = j + 1
+
+    r1 = sum(rank for rank, (_, group) in zip(ranks, combined) if group == 0)
+    u1 = r1 - n1 * (n1 + 1) / 2.0
+    mu = n1 * n2 / 2.0
+    n = n1 + n2
+    sigma = math.sqrt(n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1))))
+    if sigma == 0.0:
+        # all the values are identical.
+        return 1.0
+
+    # with the continuity correction.
+    z = (abs(u1 - mu) - 0.5) / sigma
+    return math.erfc(max(z, 0.0) / math.sqrt(2.0))
+
+
+def compare_metric(baseline, contender, metric, threshold, alpha):
+    """Compare samples of a metric and return (change, p-value, status).
+
+    The change is relative to the baseline median and positive values mean worse performance.
+    A metric regresses if the change exceeds the threshold and the difference is significant. Timing metrics need
+    enough repetitions for the significance test, while the other counters are compared just with the threshold if
+    they don't vary from run to run, e.g., allocation counts.
+    """
+    base = median(baseline)
+    cont = median(contender)
+    if base == 0.0:
+        change = 0.0 if cont == 0.0 else math.inf
+    else:
+        change = (cont - base) / abs(base)
+    if higher_is_better(metric):
+        change = -change
+
+    is_deterministic = not is_timing_metric(metric) and \
+        min(baseline) == max(baseline) and min(contender) == max(contender)
+    p_value = None if is_deterministic else mann_whitney_u_test(baseline, contender)
+
+    if abs(change) <= threshold:
+        status = 'ok'
+    elif not is_deterministic and p_value is None:
+        # too few samples to tell a change from noise.
+        status = 'unknown'
+    elif not is_deterministic and p_value >= alpha:
+        status = 'ok'
+    else:
+        status = 'REGRESSION' if change > 0 else 'improved'
+    return change, p_value, status
+
+
+def format_value(metric, value):
+    if metric in ('real_time', 'cpu_time'):
+        for unit, scale in (('s', 1e9), ('ms', 1e6), ('us', 1e3)):
+            if value >= scale:
+                return '{:.3f} {}'.format(value / scale, unit)
+        return '{:.1f} ns'.format(value)
+    for suffix, scale in (('G', 1e9), ('M', 1e6), ('k', 1e3)):
+        if abs(value) >= scale:
+            return '{:.3f}{}'.format(value / scale, suffix)
+    return '{:.3f}'.format(value).rstrip('0').rstrip('.')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare benchmark results against a baseline.')
+    parser.add_argument('baseline', help='a JSON result file of the baseline.')
+    parser.add_argument('contender', help='a JSON result file to be compared with the baseline.')
+    parser.add_argument('--threshold', type=float, default=0.1,
+                        help='the relative change of medians of timings regarded as a regression. (default: 0.1)')
+    parser.add_argument('--counter-threshold', type=float, default=None,
+                        help='the threshold for the other counters. (default: the same as --threshold)')
+    parser.add_argument('--alpha', type=float, default=0.05,
+                        help='the significance level of the Mann-Whitney U test. (default: 0.05)')
+    parser.add_argument('--filter', default='',
+                        help='a regular expression to select benchmarks to be compared. (default: all)')
+    parser.add_argument('--metric', action='append', default=[],
+                        help='a metric to be compared. can be repeated. (default: all the metrics)')
+    args = parser.parse_args()
+
+    counter_threshold = args.threshold if args.counter_threshold is None else args.counter_threshold
+    name_filter = re.compile(args.filter)
+
+    baseline, baseline_errors = load_samples(args.baseline)
+    contender, contender_errors = load_samples(args.contender)
+
+    rows = []
+    num_regressions = 0
+    num_failures = 0
+    for name, message in baseline_errors.items():
+        if name_filter.search(name):
+            print('warning: {} failed in the baseline results: {}'.format(name, message), file=sys.stderr)
+
+    for name, base_metrics in baseline.items():
+        if not name_filter.search(name):
+            continue
+        if name in contender_errors:
+            num_failures += 1
+            rows.append((name, '-', '-', '-', '-', '-', 'ERROR'))
+            print('error: {} failed in the contender results: {}'.format(name, contender_errors[name]), file=sys.stderr)
+            continue
+        if name not in contender:
+            num_failures += 1
+            rows.append((name, '-', '-', '-', '-', '-', 'MISSING'))
+            continue
+
+        cont_metrics = contender[name]
+        for metric, base_values in base_metrics.items():
+            if args.metric and metric not in args.metric:
+                continue
+            if metric not in cont_metrics:
+                num_failures += 1
+                rows.append((name, metric, format_value(metric, median(base_values)), '-', '-', '-', 'MISSING'))
+                continue
+
+            threshold = args.threshold if is_timing_metric(metric) else counter_threshold
+            change, p_value, status = compare_metric(base_values, cont_metrics[metric], metric, threshold, args.alpha)
+            if status == 'REGRESSION':
+                num_regressions += 1
+            rows.append((
+                name, metric,
+                format_value(metric, median(base_values)),
+                format_value(metric, median(cont_metrics[metric])),
+                '{:+.2f}%'.format(change * 100.0) if math.isfinite(change) else '+inf',
+                '-' if p_value is None else '{:.4f}'.format(p_value),
+                status))
+
+    for name in contender:
+        if name_filter.search(name) and name not in baseline and name not in baseline_errors:
+            print('warning: {} is missing in the baseline results.'.format(name), file=sys.stderr)
+    for name, message in contender_errors.items():
+        if name_filter.search(name) and name not in baseline:
+            num_failures += 1
+            rows.append((name, '-', '-', '-', '-', '-', 'ERROR'))
+            print('error: {} failed in the contender results: {}'.format(name, message), file=sys.stderr)
+
+    header = ('Benchmark', 'Metric', 'Baseline', 'Contender', 'Change', 'p-value', 'Status')
+    widths = [max(len(row[i]) for row in rows + [header]) for i in range(len(header))]
+    line_format = '  '.join('{:<' + str(w) + '}' if i < 2 else '{:>' + str(w) + '}' for i, w in enumerate(widths))
+    print(line_format.format(*header))
+    print('-' * (sum(widths) + 2 * (len(widths) - 1)))
+    for row in rows:
+        print(line_format.format(*row))
+
+    print()
+    print('{} regression(s) and {} failure(s) found in {} comparison(s). (worse changes are positive, thresholds: '
+          '{:.1f}% for timings, {:.1f}% for the other counters, alpha: {})'
+          .format(num_regressions, num_failures, len(rows), args.threshold * 100.0, counter_threshold * 100.0,
+                  args.alpha))
+    if num_failures > 0:
+        print('note: failures are benchmarks or metrics which failed (ERROR) or are missing (MISSING) '
+              'in the contender.')
+    if any(row[-1] == 'unknown' for row in rows):
+        print('note: run benchmarks with --benchmark_repetitions=N (N >= 3) to test the significance of timings.')
+    return 1 if num_regressions > 0 or num_failures > 0 else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+
+# Measures the compile time and the peak memory usage of translation units with typical include patterns of fkYAML.
+# Each translation unit in the compile_time directory is compiled against each include directory (the multi-header
+# and the single-header versions by default), and the results can be written in the JSON format of the Google
+# Benchmark library so that compare.py can compare them against a baseline.
+# Only the Python standard library is required. The peak memory usage is measured only on POSIX platforms.
+
+import argparse
+import json
+import os
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.normpath(os.path.join(SCRIPT_DIR, '..', '..'))
+SOURCE_DIR = os.path.join(SCRIPT_DIR, 'compile_time')
+DEFAULT_INCLUDE_DIRS = [os.path.join(ROOT_DIR, 'include'), os.path.join(ROOT_DIR, 'single_include')]
+DEFAULT_FLAGS = ['-std=c++11', '-O0']
+
+
+def run_compiler(command):
+    """Run a compiler command and return (wall time in seconds, CPU time in seconds, peak RSS in bytes or None)."""
+    begin = time.perf_counter()
+    if hasattr(os, 'wait4'):
+        proc = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+        stderr = proc.stderr.read()
+        _, status, usage = os.wait4(proc.pid, 0)
+        proc.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, 'waitstatus_to_exitcode') else status
+        wall = time.perf_counter() - begin
+        cpu = usage.ru_utime + usage.ru_stime
+        # ru_maxrss is in kilobytes except on macOS.
+        peak_rss = usage.ru_maxrss if sys.platform == 'darwin' else usage.ru_maxrss * 1024
+    else:
+        proc = subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+        stderr = proc.stderr
+        wall = time.perf_counter() - begin
+        cpu = wall
+        peak_rss = None
+
+    if proc.returncode != 0:
+        raise RuntimeError('failed to compile with `{}`:\n{}'.format(
+            ' '.join(shlex.quote(arg) for arg in command), stderr.decode(errors='replace')))
+    return wall, cpu, peak_rss
+
+
+def median(values):
+    s = sorted(values)
+    n = len(s)
+    return s[n // 2] if n % 2 == 1 else (s[n // 2 - 1] + s[n // 2]) / 2.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Measure compile times of translation units including fkYAML.')
+    parser.add_argument('--compiler', default=os.environ.get('CXX', 'c++'),
+                        help='a C++ compiler with the GCC compatible options. (default: $CXX or c++)')
+    parser.add_argument('--flag', action='append', default=None,
+                        help='a compiler flag. can be repeated. (default: {})'.format(' '.join(DEFAULT_FLAGS)))
+    parser.add_argument('--include-dir', action='append', default=None,
+                        help='an include directory of fkYAML. can be repeated. (default: include and single_include)')
+    parser.add_argument('--repetitions', type=int, default=5,
+                        help='the number of compilations of each translation unit. (default: 5)')
+    parser.add_argument('--filter', default='',
+                        help='a regular expression to select benchmarks to be run. (default: all)')
+    parser.add_argument('--out', default=None, help='a JSON file to write the results into.')
+    args = parser.parse_args()
+
+    flags = DEFAULT_FLAGS if args.flag is None else args.flag
+    include_dirs = DEFAULT_INCLUDE_DIRS if args.include_dir is None else args.include_dir
+    name_filter = re.compile(args.filter)
+    sources = sorted(f for f in os.listdir(SOURCE_DIR) if f.endswith('.cpp'))
+
+    benchmarks = []
+    rows = []
+    work_dir = tempfile.mkdtemp(prefix='fkyaml_compile_time_')
+    try:
+        for source in sources:
+            for include_dir in include_dirs:
+                name = '{}/{}'.format(os.path.splitext(source)[0], os.path.basename(os.path.normpath(include_dir)))
+                if not name_filter.search(name):
+                    continue
+
+                obj = os.path.join(work_dir, 'out.o')
+                command = [args.compiler] + flags + ['-I', include_dir, '-c', os.path.join(SOURCE_DIR, source),
+                                                     '-o', obj]
+                walls, cpus, peaks = [], [], []
+                for i in range(args.repetitions):
+                    wall, cpu, peak_rss = run_compiler(command)
+                    walls.append(wall)
+                    cpus.append(cpu)
+                    peaks.append(peak_rss)
+
+                    entry = {
+                        'name': name, 'run_name': name, 'run_type': 'iteration',
+                        'repetitions': args.repetitions, 'repetition_index': i, 'threads': 1, 'iterations': 1,
+                        'real_time': wall * 1e3, 'cpu_time': cpu * 1e3, 'time_unit': 'ms',
+                        'object_bytes': os.path.getsize(obj),
+                    }
+                    if peak_rss is not None:
+                        entry['peak_rss_bytes'] = peak_rss
+                    benchmarks.append(entry)
+
+                rows.append((
+                    name,
+                    '{:.3f} s'.format(median(walls)),
+                    '{:.3f} s'.format(median(cpus)),
+                    '-' if peaks[0] is None else '{:.1f} MiB'.format(max(peaks) / 1048576.0),
+                    '{:.1f} KiB'.format(os.path.getsize(obj) / 1024.0)))
+                print('{}: done'.format(name), file=sys.stderr)
+    finally:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+    header = ('Translation Unit', 'Wall Time', 'CPU Time', 'Peak RSS', 'Object Size')
+    widths = [max(len(row[i]) for row in rows + [header]) for i in range(len(header))]
+    line_format = '  '.join('{:<' + str(w) + '}' if i == 0 else '{:>' + str(w) + '}' for i, w in enumerate(widths))
+    print('compiler: {} {}'.format(args.compiler, ' '.join(flags)))
+    print('(medians of {} compilations for the times, and the maximum for the peak RSS)'.format(args.repetitions))
+    print(line_format.format(*header))
+    print('-' * (sum(widths) + 2 * (len(widths) - 1)))
+    for row in rows:
+        print(line_format.format(*row))
+
+    if args.out:
+        context = {
+            'date': time.strftime('%Y-%m-%dT%H:%M:%S%z'),
+            'compiler': args.compiler,
+            'flags': ' '.join(flags),
+        }
+        with open(args.out, 'w') as f:
+            json.dump({'context': context, 'benchmarks': benchmarks}, f, indent=2)
+            f.write('\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
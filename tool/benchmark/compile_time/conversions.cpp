@@ -0,0 +1,51 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+// A translation unit which converts nodes from/into user-defined types and standard containers.
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <fkYAML/node.hpp>
+
+namespace ns {
+
+struct person {
+    std::string name;
+    int age;
+    std::vector<std::string> tags;
+};
+
+void from_node(const fkyaml::node& n, person& p) {
+    p.name = n["name"].get_value<std::string>();
+    p.age = n["age"].get_value<int>();
+    p.tags = n["tags"].get_value<std::vector<std::string>>();
+}
+
+void to_node(fkyaml::node& n, const person& p) {
+    n = {{"name", p.name}, {"age", p.age}};
+    n["tags"] = fkyaml::node::sequence();
+    for (const auto& tag : p.tags) {
+        n["tags"].get_value_ref<fkyaml::node::sequence_type&>().emplace_back(tag);
+    }
+}
+
+} // namespace ns
+
+std::map<std::string, ns::person> read_people(const std::string& input) {
+    return fkyaml::node::deserialize(input).get_value<std::map<std::string, ns::person>>();
+}
+
+std::string write_people(const std::map<std::string, ns::person>& people) {
+    fkyaml::node root = fkyaml::node::mapping();
+    for (const auto& entry : people) {
+        root[entry.first] = entry.second;
+    }
+    return fkyaml::node::serialize(root);
+}
@@ -0,0 +1,24 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+// A translation unit which deserializes a YAML document and reads some values from it.
+
+#include <cstdint>
+#include <string>
+
+#include <fkYAML/node.hpp>
+
+std::string read_name(const std::string& input) {
+    fkyaml::node root = fkyaml::node::deserialize(input);
+    return root["name"].get_value<std::string>();
+}
+
+int64_t read_count(const std::string& input) {
+    fkyaml::node root = fkyaml::node::deserialize(input);
+    return root["count"].get_value<int64_t>();
+}
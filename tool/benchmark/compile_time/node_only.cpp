@@ -0,0 +1,29 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+// A translation unit which only passes nodes around by reference, including the whole library.
+
+#include <fkYAML/node.hpp>
+
+class config_holder {
+public:
+    explicit config_holder(const fkyaml::node& root)
+        : mp_root(&root) {
+    }
+
+    const fkyaml::node& root() const {
+        return *mp_root;
+    }
+
+private:
+    const fkyaml::node* mp_root;
+};
+
+const fkyaml::node& root_of(const config_holder& holder) {
+    return holder.root();
+}
@@ -0,0 +1,18 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+// A translation unit which builds a node tree and serializes it into a YAML document.
+
+#include <string>
+
+#include <fkYAML/node.hpp>
+
+std::string write_config(const std::string& name, int count) {
+    fkyaml::node root = {{"name", name}, {"count", count}, {"tags", {"foo", "bar"}}};
+    return fkyaml::node::serialize(root);
+}
@@ -12,21 +12,29 @@
 #endif
 
 #include <cassert>
+#include <cstdlib>
 #include <cstring>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
 #include <fkYAML/node.hpp>
+
+#ifdef FK_YAML_BM_HAS_YAML_CPP
 #include <yaml-cpp/yaml.h>
+#endif
 
 #ifdef FK_YAML_BM_HAS_LIBFYAML
 #include <libfyaml.h>
 #endif
 
+#ifdef FK_YAML_BM_HAS_RAPIDYAML
 #include <ryml.hpp>
 #include <ryml_std.hpp>
 #include <c4/yml/parse.hpp>
+#endif
 
 static std::string test_src {};
 
@@ -53,7 +61,7 @@ int main(int argc, char** argv) {
 }
 
 //
-// Benchmarking functions.
+// Benchmarking functions for deserialization.
 //
 
 // fkYAML
@@ -66,6 +74,7 @@ void bm_fkyaml_parse(benchmark::State& st) {
     st.SetBytesProcessed(st.iterations() * test_src.size());
 }
 
+#ifdef FK_YAML_BM_HAS_YAML_CPP
 // yaml-cpp
 void bm_yamlcpp_parse(benchmark::State& st) {
     for (auto _ : st) {
@@ -75,6 +84,7 @@ void bm_yamlcpp_parse(benchmark::State& st) {
     st.SetItemsProcessed(st.iterations());
     st.SetBytesProcessed(st.iterations() * test_src.size());
 }
+#endif
 
 #ifdef FK_YAML_BM_HAS_LIBFYAML
 // libfyaml
@@ -92,6 +102,7 @@ void bm_libfyaml_parse(benchmark::State& st) {
 }
 #endif
 
+#ifdef FK_YAML_BM_HAS_RAPIDYAML
 // rapidyaml (in place)
 void bm_rapidyaml_parse_inplace(benchmark::State& st) {
     std::string in_place_buff(test_src.size(), '\0');
@@ -121,14 +132,140 @@ void bm_rapidyaml_parse_arena(benchmark::State& st) {
     st.SetItemsProcessed(st.iterations());
     st.SetBytesProcessed(st.iterations() * test_src.size());
 }
+#endif
+
+//
+// Benchmarking functions for serialization.
+// The input is deserialized in advance, and the sizes of the serialized outputs are reported as processed bytes.
+//
+
+// fkYAML
+void bm_fkyaml_serialize(benchmark::State& st) {
+    fkyaml::node n = fkyaml::node::deserialize(test_src);
+    std::size_t out_size = 0;
+
+    for (auto _ : st) {
+        std::string out = fkyaml::node::serialize(n);
+        out_size = out.size();
+        benchmark::DoNotOptimize(out);
+    }
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * out_size);
+}
+
+void bm_fkyaml_serialize_docs(benchmark::State& st) {
+    std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs(test_src);
+    std::size_t out_size = 0;
+
+    for (auto _ : st) {
+        std::string out = fkyaml::node::serialize_docs(docs);
+        out_size = out.size();
+        benchmark::DoNotOptimize(out);
+    }
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * out_size);
+}
+
+void bm_fkyaml_insertion_operator(benchmark::State& st) {
+    fkyaml::node n = fkyaml::node::deserialize(test_src);
+    std::size_t out_size = 0;
+
+    for (auto _ : st) {
+        std::ostringstream oss;
+        oss << n;
+        out_size = static_cast<std::size_t>(oss.tellp());
+        benchmark::DoNotOptimize(oss);
+    }
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * out_size);
+}
+
+#ifdef FK_YAML_BM_HAS_YAML_CPP
+// yaml-cpp
+void bm_yamlcpp_emit(benchmark::State& st) {
+    YAML::Node n = YAML::Load(test_src);
+    std::size_t out_size = 0;
+
+    for (auto _ : st) {
+        YAML::Emitter emitter;
+        emitter << n;
+        out_size = emitter.size();
+        benchmark::DoNotOptimize(emitter.c_str());
+    }
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * out_size);
+}
+#endif
+
+#ifdef FK_YAML_BM_HAS_LIBFYAML
+// libfyaml
+void bm_libfyaml_emit(benchmark::State& st) {
+    fy_document* p_fyd = fy_document_build_from_string(nullptr, test_src.c_str(), test_src.size());
+    std::size_t out_size = 0;
+
+    for (auto _ : st) {
+        char* p_out = fy_emit_document_to_string(p_fyd, FYECF_DEFAULT);
+        out_size = std::strlen(p_out);
+        benchmark::DoNotOptimize(p_out);
+        std::free(p_out);
+    }
+
+    fy_document_destroy(p_fyd);
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * out_size);
+}
+#endif
+
+#ifdef FK_YAML_BM_HAS_RAPIDYAML
+// rapidyaml
+void bm_rapidyaml_emit(benchmark::State& st) {
+    ryml::Tree tree = ryml::parse_in_arena(c4::to_csubstr(test_src).trimr('\0'));
+    std::size_t out_size = 0;
+
+    for (auto _ : st) {
+        std::string out = ryml::emitrs_yaml<std::string>(tree);
+        out_size = out.size();
+        benchmark::DoNotOptimize(out);
+    }
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * out_size);
+}
+#endif
 
 // Register benchmarking functions.
 BENCHMARK(bm_fkyaml_parse);
+
+#ifdef FK_YAML_BM_HAS_YAML_CPP
 BENCHMARK(bm_yamlcpp_parse);
+#endif
 
 #ifdef FK_YAML_BM_HAS_LIBFYAML
 BENCHMARK(bm_libfyaml_parse);
 #endif
 
+#ifdef FK_YAML_BM_HAS_RAPIDYAML
 BENCHMARK(bm_rapidyaml_parse_inplace);
 BENCHMARK(bm_rapidyaml_parse_arena);
+#endif
+
+BENCHMARK(bm_fkyaml_serialize);
+BENCHMARK(bm_fkyaml_serialize_docs);
+BENCHMARK(bm_fkyaml_insertion_operator);
+
+#ifdef FK_YAML_BM_HAS_YAML_CPP
+BENCHMARK(bm_yamlcpp_emit);
+#endif
+
+#ifdef FK_YAML_BM_HAS_LIBFYAML
+BENCHMARK(bm_libfyaml_emit);
+#endif
+
+#ifdef FK_YAML_BM_HAS_RAPIDYAML
+BENCHMARK(bm_rapidyaml_emit);
+#endif
@@ -0,0 +1,298 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <fkYAML/node.hpp>
+
+#include "workload.hpp"
+
+//
+// Inputs for the micro benchmarks.
+// Documents are generated with the workload generator, and scalar tokens are collected from them with the lexer so
+// that each stage is fed with what it would see in the whole deserialization process.
+//
+
+namespace {
+
+/// @brief Kinds of token distributions.
+enum class token_dist {
+    SHORT_KEYS,     //!< a wide mapping of short keys and values.
+    NUMERIC,        //!< sequences of integers and floating point values.
+    QUOTED_ESCAPES, //!< a sequence of double-quoted scalars with escape sequences.
+    BLOCK_SCALARS,  //!< a mapping of literal and folded block scalars.
+};
+
+/// The approximate size of each input document.
+constexpr std::size_t input_size = 256 << 10;
+
+/// @brief Generate a sequence of double-quoted scalars with escape sequences.
+/// @param target_size The approximate size of the output.
+/// @return std::string The generated document.
+std::string generate_quoted_escapes(std::size_t target_size) {
+    static const char* const entries[] = {
+        "- \"plain text without escapes\"\n",
+        "- \"tab\\tseparated\\tvalues\\n\"\n",
+        "- \"\\\"quoted\\\" and \\\\backslashed\\\\\"\n",
+        "- \"unicode \\u00E9\\u3042 and \\U0001F600 escapes\"\n",
+        "- \"hex \\x41\\x42\\x43 escapes with \\0 null\"\n",
+        "- \"line\\\n  continuation\"\n",
+    };
+    constexpr std::size_t num_entries = sizeof(entries) / sizeof(entries[0]);
+
+    std::string out;
+    std::size_t index = 0;
+    while (out.size() < target_size) {
+        out += entries[index++ % num_entries];
+    }
+    return out;
+}
+
+/// @brief Generate an input document of the given token distribution.
+/// @param dist A token distribution.
+/// @return std::string The generated document.
+std::string generate_input(token_dist dist) {
+    fkyaml_bm::workload_generator generator;
+    switch (dist) {
+    case token_dist::SHORT_KEYS:
+        return generator.generate(fkyaml_bm::workload_shape::WIDE_MAPPING, input_size);
+    case token_dist::NUMERIC:
+        return generator.generate(fkyaml_bm::workload_shape::INT_SEQUENCE, input_size / 2) +
+               generator.generate(fkyaml_bm::workload_shape::FLOAT_SEQUENCE, input_size / 2);
+    case token_dist::QUOTED_ESCAPES:
+        return generate_quoted_escapes(input_size);
+    case token_dist::BLOCK_SCALARS:
+    default:
+        return generator.generate(fkyaml_bm::workload_shape::BLOCK_SCALARS, input_size);
+    }
+}
+
+/// @brief Collect scalar tokens of the given type from the input.
+/// @param input An input document.
+/// @param type The type of scalar tokens to be collected.
+/// @return std::vector<std::string> The collected tokens.
+std::vector<std::string> collect_tokens(const std::string& input, fkyaml::detail::lexical_token_t type) {
+    std::vector<std::string> tokens;
+    fkyaml::detail::lexical_analyzer lexer {fkyaml::detail::str_view(input)};
+    fkyaml::detail::lexical_token token = lexer.get_next_token();
+    while (token.type != fkyaml::detail::lexical_token_t::END_OF_BUFFER) {
+        if (token.type == type) {
+            tokens.emplace_back(token.str.begin(), token.str.end());
+        }
+        token = lexer.get_next_token();
+    }
+    return tokens;
+}
+
+/// @brief Get the total size of the given tokens.
+/// @param tokens Tokens.
+/// @return std::size_t The total size in bytes.
+std::size_t total_size(const std::vector<std::string>& tokens) {
+    std::size_t size = 0;
+    for (const auto& token : tokens) {
+        size += token.size();
+    }
+    return size;
+}
+
+} // namespace
+
+//
+// lexical_analyzer::get_next_token()
+//
+
+void bm_lexer(benchmark::State& st, token_dist dist) {
+    std::string input = generate_input(dist);
+    std::size_t num_tokens = 0;
+
+    for (auto _ : st) {
+        fkyaml::detail::lexical_analyzer lexer {fkyaml::detail::str_view(input)};
+        fkyaml::detail::lexical_token token = lexer.get_next_token();
+        num_tokens = 1;
+        while (token.type != fkyaml::detail::lexical_token_t::END_OF_BUFFER) {
+            token = lexer.get_next_token();
+            ++num_tokens;
+        }
+        benchmark::DoNotOptimize(token);
+    }
+
+    st.SetItemsProcessed(st.iterations() * num_tokens);
+    st.SetBytesProcessed(st.iterations() * input.size());
+}
+
+//
+// scalar_scanner::scan()
+//
+
+void bm_scalar_scanner(benchmark::State& st, token_dist dist) {
+    std::vector<std::string> tokens =
+        collect_tokens(generate_input(dist), fkyaml::detail::lexical_token_t::PLAIN_SCALAR);
+
+    for (auto _ : st) {
+        for (const auto& token : tokens) {
+            fkyaml::node_type type = fkyaml::detail::scalar_scanner::scan(token.data(), token.data() + token.size());
+            benchmark::DoNotOptimize(type);
+        }
+    }
+
+    st.SetItemsProcessed(st.iterations() * tokens.size());
+    st.SetBytesProcessed(st.iterations() * total_size(tokens));
+}
+
+//
+// detail::atoi(), detail::atof() and detail::atob()
+//
+
+/// @brief Collect plain scalar tokens which are detected as the given type.
+/// @param type The node type of tokens to be collected.
+/// @return std::vector<std::string> The collected tokens.
+std::vector<std::string> collect_scalars_of(fkyaml::node_type type) {
+    std::vector<std::string> tokens =
+        collect_tokens(generate_input(token_dist::NUMERIC), fkyaml::detail::lexical_token_t::PLAIN_SCALAR);
+    std::vector<std::string> scalars;
+    for (auto& token : tokens) {
+        if (fkyaml::detail::scalar_scanner::scan(token.data(), token.data() + token.size()) == type) {
+            scalars.push_back(std::move(token));
+        }
+    }
+    return scalars;
+}
+
+void bm_atoi(benchmark::State& st) {
+    std::vector<std::string> tokens = collect_scalars_of(fkyaml::node_type::INTEGER);
+
+    for (auto _ : st) {
+        for (const auto& token : tokens) {
+            int64_t value = 0;
+            bool ret = fkyaml::detail::atoi(token.data(), token.data() + token.size(), value);
+            benchmark::DoNotOptimize(ret);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    st.SetItemsProcessed(st.iterations() * tokens.size());
+    st.SetBytesProcessed(st.iterations() * total_size(tokens));
+}
+
+void bm_atof(benchmark::State& st) {
+    std::vector<std::string> tokens = collect_scalars_of(fkyaml::node_type::FLOAT);
+
+    for (auto _ : st) {
+        for (const auto& token : tokens) {
+            double value = 0.0;
+            bool ret = fkyaml::detail::atof(token.data(), token.data() + token.size(), value);
+            benchmark::DoNotOptimize(ret);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    st.SetItemsProcessed(st.iterations() * tokens.size());
+    st.SetBytesProcessed(st.iterations() * total_size(tokens));
+}
+
+void bm_atob(benchmark::State& st) {
+    static const char* const literals[] = {"true", "false", "True", "False", "TRUE", "FALSE"};
+    std::vector<std::string> tokens;
+    for (std::size_t i = 0; i < 1024; i++) {
+        tokens.emplace_back(literals[i % (sizeof(literals) / sizeof(literals[0]))]);
+    }
+
+    for (auto _ : st) {
+        for (const auto& token : tokens) {
+            bool value = false;
+            bool ret = fkyaml::detail::atob(token.data(), token.data() + token.size(), value);
+            benchmark::DoNotOptimize(ret);
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    st.SetItemsProcessed(st.iterations() * tokens.size());
+    st.SetBytesProcessed(st.iterations() * total_size(tokens));
+}
+
+//
+// yaml_escaper::unescape()
+//
+
+void bm_unescape(benchmark::State& st) {
+    std::vector<std::string> tokens = collect_tokens(
+        generate_input(token_dist::QUOTED_ESCAPES), fkyaml::detail::lexical_token_t::DOUBLE_QUOTED_SCALAR);
+    std::string buff;
+
+    for (auto _ : st) {
+        for (const auto& token : tokens) {
+            // copy unescaped characters as they are just like the scalar parser does.
+            buff.clear();
+            const char* p_cur = token.data();
+            const char* p_end = p_cur + token.size();
+            for (; p_cur != p_end; ++p_cur) {
+                if (*p_cur != '\\') {
+                    buff.push_back(*p_cur);
+                    continue;
+                }
+                bool ret = fkyaml::detail::yaml_escaper::unescape(p_cur, p_end, buff);
+                benchmark::DoNotOptimize(ret);
+            }
+            benchmark::DoNotOptimize(buff);
+        }
+    }
+
+    st.SetItemsProcessed(st.iterations() * tokens.size());
+    st.SetBytesProcessed(st.iterations() * total_size(tokens));
+}
+
+//
+// UTF-8 validation of input buffers
+//
+
+void bm_utf8_validation(benchmark::State& st, bool has_multibyte_chars) {
+    std::string input;
+    if (has_multibyte_chars) {
+        // a mixture of 1 to 4 byte characters.
+        static const char* const text = "ascii, \xC3\xA9\xC3\xA8 (2 bytes), \xE3\x81\x82\xE3\x81\x84 (3 bytes), "
+                                        "\xF0\x9F\x98\x80 (4 bytes)\n";
+        while (input.size() < input_size) {
+            input += text;
+        }
+    }
+    else {
+        input = generate_input(token_dist::SHORT_KEYS);
+    }
+
+    for (auto _ : st) {
+        fkyaml::detail::validate_utf8_chars(input.data(), input.data() + input.size());
+        benchmark::ClobberMemory();
+    }
+
+    st.SetBytesProcessed(st.iterations() * input.size());
+}
+
+// Register benchmarking functions.
+BENCHMARK_CAPTURE(bm_lexer, short_keys, token_dist::SHORT_KEYS);
+BENCHMARK_CAPTURE(bm_lexer, numeric, token_dist::NUMERIC);
+BENCHMARK_CAPTURE(bm_lexer, quoted_escapes, token_dist::QUOTED_ESCAPES);
+BENCHMARK_CAPTURE(bm_lexer, block_scalars, token_dist::BLOCK_SCALARS);
+
+BENCHMARK_CAPTURE(bm_scalar_scanner, short_keys, token_dist::SHORT_KEYS);
+BENCHMARK_CAPTURE(bm_scalar_scanner, numeric, token_dist::NUMERIC);
+
+BENCHMARK(bm_atoi);
+BENCHMARK(bm_atof);
+BENCHMARK(bm_atob);
+
+BENCHMARK(bm_unescape);
+
+BENCHMARK_CAPTURE(bm_utf8_validation, ascii, false);
+BENCHMARK_CAPTURE(bm_utf8_validation, multibyte, true);
+
+BENCHMARK_MAIN();
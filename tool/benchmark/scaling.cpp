@@ -0,0 +1,138 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <fkYAML/node.hpp>
+
+#include "workload.hpp"
+
+//
+// Benchmarking functions.
+// Each benchmark generates its workload before the timing loop, so the generation is not measured.
+//
+
+void bm_fkyaml_parse(benchmark::State& st, fkyaml_bm::workload_shape shape, std::size_t size) {
+    std::string src = fkyaml_bm::workload_generator().generate(shape, size);
+
+    for (auto _ : st) {
+        if (shape == fkyaml_bm::workload_shape::MULTI_DOCS) {
+            std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs(src);
+            benchmark::DoNotOptimize(docs);
+        }
+        else {
+            fkyaml::node n = fkyaml::node::deserialize(src);
+            benchmark::DoNotOptimize(n);
+        }
+    }
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * src.size());
+    st.counters["input_size"] = static_cast<double>(src.size());
+}
+
+void bm_fkyaml_serialize(benchmark::State& st, fkyaml_bm::workload_shape shape, std::size_t size) {
+    std::string src = fkyaml_bm::workload_generator().generate(shape, size);
+    std::vector<fkyaml::node> docs = fkyaml::node::deserialize_docs(src);
+    std::size_t out_size = 0;
+
+    for (auto _ : st) {
+        std::string out = fkyaml::node::serialize_docs(docs);
+        out_size = out.size();
+        benchmark::DoNotOptimize(out);
+    }
+
+    st.SetItemsProcessed(st.iterations());
+    st.SetBytesProcessed(st.iterations() * out_size);
+    st.counters["input_size"] = static_cast<double>(src.size());
+}
+
+//
+// Registration of the benchmarks over the workload shapes and sizes.
+//
+
+static void print_usage(const char* program) {
+    std::fprintf(stderr, "usage: %s [--min_size=<size>] [--max_size=<size>] [--size_multiplier=<n>]", program);
+    std::fprintf(stderr, " [--shape=<shape>] [<Google Benchmark options>...]\n");
+    std::fprintf(stderr, "  size: the approximate workload size in bytes");
+    std::fprintf(stderr, " with an optional K, M or G suffix (e.g., 64K)\n");
+    std::fprintf(stderr, "  The workloads are generated for the sizes from min_size (default: 1K) to max_size");
+    std::fprintf(stderr, " (default: 16M), multiplied by size_multiplier (default: 8) at each step.\n");
+}
+
+int main(int argc, char** argv) {
+    std::size_t min_size = 1 << 10;
+    std::size_t max_size = 16 << 20;
+    std::size_t multiplier = 8;
+    std::vector<fkyaml_bm::workload_shape> shapes;
+
+    // consume the options of this tool and leave the others to the Google Benchmark library.
+    int num_args = 1;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        bool is_valid = true;
+        if (std::strncmp(arg, "--min_size=", 11) == 0) {
+            is_valid = fkyaml_bm::parse_size(arg + 11, min_size);
+        }
+        else if (std::strncmp(arg, "--max_size=", 11) == 0) {
+            is_valid = fkyaml_bm::parse_size(arg + 11, max_size);
+        }
+        else if (std::strncmp(arg, "--size_multiplier=", 18) == 0) {
+            is_valid = fkyaml_bm::parse_size(arg + 18, multiplier) && multiplier > 1;
+        }
+        else if (std::strncmp(arg, "--shape=", 8) == 0) {
+            fkyaml_bm::workload_shape shape {};
+            is_valid = fkyaml_bm::from_string(arg + 8, shape);
+            shapes.push_back(shape);
+        }
+        else if (std::strcmp(arg, "--help") == 0) {
+            print_usage(argv[0]);
+            is_valid = false;
+        }
+        else {
+            argv[num_args++] = argv[i];
+            continue;
+        }
+
+        if (!is_valid) {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+    argc = num_args;
+
+    if (shapes.empty()) {
+        for (int i = 0; i < fkyaml_bm::num_workload_shapes; i++) {
+            shapes.push_back(static_cast<fkyaml_bm::workload_shape>(i));
+        }
+    }
+
+    for (fkyaml_bm::workload_shape shape : shapes) {
+        for (std::size_t size = min_size; size <= max_size; size *= multiplier) {
+            std::string suffix = std::string("/") + fkyaml_bm::to_string(shape) + "/" + std::to_string(size);
+            benchmark::RegisterBenchmark(("bm_fkyaml_parse" + suffix).c_str(), bm_fkyaml_parse, shape, size)
+                ->Unit(benchmark::kMicrosecond);
+            benchmark::RegisterBenchmark(("bm_fkyaml_serialize" + suffix).c_str(), bm_fkyaml_serialize, shape, size)
+                ->Unit(benchmark::kMicrosecond);
+        }
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,403 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifndef FK_YAML_TOOL_BENCHMARK_WORKLOAD_HPP
+#define FK_YAML_TOOL_BENCHMARK_WORKLOAD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace fkyaml_bm {
+
+/// @brief Shapes of generated workloads.
+enum class workload_shape {
+    DEEP_NESTING,     //!< block mappings nested 64 levels deep.
+    WIDE_MAPPING,     //!< a single block mapping with a lot of keys.
+    INT_SEQUENCE,     //!< a long block sequence of integers.
+    FLOAT_SEQUENCE,   //!< a long block sequence of floating point values.
+    BLOCK_SCALARS,    //!< a mapping of long literal and folded block scalars.
+    ANCHORS_ALIASES,  //!< a sequence of anchored mappings and aliases to them.
+    FLOW_COLLECTIONS, //!< a sequence of nested flow sequences and mappings.
+    CRLF,             //!< a block mapping of records with CR+LF line breaks.
+    UTF16,            //!< a block mapping of records encoded in UTF-16LE with a BOM.
+    MULTI_DOCS,       //!< a stream of a lot of small documents.
+};
+
+/// @brief The number of workload shapes.
+constexpr int num_workload_shapes = static_cast<int>(workload_shape::MULTI_DOCS) + 1;
+
+/// @brief Get the name of the given workload shape.
+/// @param shape A workload shape.
+/// @return const char* The name of the shape.
+inline const char* to_string(workload_shape shape) {
+    switch (shape) {
+    case workload_shape::DEEP_NESTING:
+        return "deep_nesting";
+    case workload_shape::WIDE_MAPPING:
+        return "wide_mapping";
+    case workload_shape::INT_SEQUENCE:
+        return "int_sequence";
+    case workload_shape::FLOAT_SEQUENCE:
+        return "float_sequence";
+    case workload_shape::BLOCK_SCALARS:
+        return "block_scalars";
+    case workload_shape::ANCHORS_ALIASES:
+        return "anchors_aliases";
+    case workload_shape::FLOW_COLLECTIONS:
+        return "flow_collections";
+    case workload_shape::CRLF:
+        return "crlf";
+    case workload_shape::UTF16:
+        return "utf16";
+    case workload_shape::MULTI_DOCS:
+    default:
+        return "multi_docs";
+    }
+}
+
+/// @brief Find the workload shape with the given name.
+/// @param name The name of a workload shape.
+/// @param shape The storage for the found shape.
+/// @return true if found, false otherwise.
+inline bool from_string(const char* name, workload_shape& shape) {
+    for (int i = 0; i < num_workload_shapes; i++) {
+        if (std::strcmp(name, to_string(static_cast<workload_shape>(i))) == 0) {
+            shape = static_cast<workload_shape>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+/// @brief Parse a size string with an optional K, M or G suffix (powers of 1024), e.g., "64K" or "1G".
+/// @param str A size string.
+/// @param size The storage for the parsed size.
+/// @return true if the string is a valid size, false otherwise.
+inline bool parse_size(const char* str, std::size_t& size) {
+    char* p_end = nullptr;
+    unsigned long long value = std::strtoull(str, &p_end, 10);
+    if (p_end == str) {
+        return false;
+    }
+
+    switch (*p_end) {
+    case '\0':
+        break;
+    case 'K':
+    case 'k':
+        value <<= 10;
+        ++p_end;
+        break;
+    case 'M':
+    case 'm':
+        value <<= 20;
+        ++p_end;
+        break;
+    case 'G':
+    case 'g':
+        value <<= 30;
+        ++p_end;
+        break;
+    default:
+        return false;
+    }
+
+    size = static_cast<std::size_t>(value);
+    return *p_end == '\0' && size > 0;
+}
+
+/// @brief A deterministic generator of YAML workloads.
+/// @note The outputs only depend on the shape, the target size and the seed, so the same workload can be reproduced
+/// on any platform. The random numbers are generated by xorshift64 instead of <random> distributions whose outputs
+/// differ between standard library implementations.
+class workload_generator {
+public:
+    /// @brief Construct a new workload_generator object.
+    /// @param seed The seed of pseudo random numbers.
+    explicit workload_generator(uint64_t seed = 0x9E3779B97F4A7C15ull)
+        : m_state(seed ? seed : 1) {
+    }
+
+    /// @brief Generate a workload of the given shape.
+    /// @param shape The shape of the workload.
+    /// @param target_size The approximate size of the workload in bytes. The output stops at the first entry which
+    /// reaches the target size, and thus, it may be slightly larger than the target size.
+    /// @return std::string The generated workload.
+    std::string generate(workload_shape shape, std::size_t target_size) {
+        std::string out;
+        out.reserve(target_size + 1024);
+
+        switch (shape) {
+        case workload_shape::DEEP_NESTING:
+            generate_deep_nesting(out, target_size);
+            break;
+        case workload_shape::WIDE_MAPPING:
+            generate_wide_mapping(out, target_size);
+            break;
+        case workload_shape::INT_SEQUENCE:
+            while (out.size() < target_size) {
+                out += "- ";
+                append_int(out);
+                out += '\n';
+            }
+            break;
+        case workload_shape::FLOAT_SEQUENCE:
+            while (out.size() < target_size) {
+                out += "- ";
+                append_float(out);
+                out += '\n';
+            }
+            break;
+        case workload_shape::BLOCK_SCALARS:
+            generate_block_scalars(out, target_size);
+            break;
+        case workload_shape::ANCHORS_ALIASES:
+            generate_anchors_aliases(out, target_size);
+            break;
+        case workload_shape::FLOW_COLLECTIONS:
+            generate_flow_collections(out, target_size);
+            break;
+        case workload_shape::CRLF:
+            generate_records(out, target_size, "\r\n");
+            break;
+        case workload_shape::UTF16: {
+            // each ASCII character takes 2 bytes in UTF-16.
+            std::string utf8;
+            generate_records(utf8, target_size / 2, "\n");
+            out += "\xFF\xFE";
+            for (char c : utf8) {
+                out += c;
+                out += '\0';
+            }
+            break;
+        }
+        case workload_shape::MULTI_DOCS:
+        default:
+            while (out.size() < target_size) {
+                out += "---\n";
+                append_record(out, "\n", "");
+            }
+            break;
+        }
+
+        return out;
+    }
+
+private:
+    /// @brief Get the next pseudo random number. (xorshift64)
+    /// @return uint64_t A pseudo random number.
+    uint64_t next() noexcept {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 7;
+        m_state ^= m_state << 17;
+        return m_state;
+    }
+
+    /// @brief Append a pseudo random integer.
+    /// @param out The output buffer.
+    void append_int(std::string& out) {
+        int64_t value = static_cast<int64_t>(next() % 2000000001ull) - 1000000000;
+        out += std::to_string(value);
+    }
+
+    /// @brief Append a pseudo random floating point value with 6 fractional digits.
+    /// @param out The output buffer.
+    void append_float(std::string& out) {
+        uint64_t value = next();
+        if (value & 1) {
+            out += '-';
+        }
+        out += std::to_string((value >> 1) % 100000);
+        out += '.';
+        std::string frac = std::to_string((value >> 20) % 1000000);
+        out.append(6 - frac.size(), '0');
+        out += frac;
+    }
+
+    /// @brief Append a pseudo random word of lowercase letters.
+    /// @param out The output buffer.
+    /// @param min_len The minimum length of the word.
+    /// @param max_len The maximum length of the word.
+    void append_word(std::string& out, std::size_t min_len, std::size_t max_len) {
+        std::size_t len = min_len + static_cast<std::size_t>(next() % (max_len - min_len + 1));
+        for (std::size_t i = 0; i < len; i++) {
+            out += static_cast<char>('a' + next() % 26);
+        }
+    }
+
+    /// @brief Append a record, i.e., a block mapping of a few scalars and a flow sequence.
+    /// @param out The output buffer.
+    /// @param newline The line break to be used.
+    /// @param indent The indentation of the record.
+    void append_record(std::string& out, const char* newline, const char* indent) {
+        out += indent;
+        out += "id: ";
+        append_int(out);
+        out += newline;
+        out += indent;
+        out += "name: ";
+        append_word(out, 4, 12);
+        out += newline;
+        out += indent;
+        out += "score: ";
+        append_float(out);
+        out += newline;
+        out += indent;
+        out += "active: ";
+        out += (next() & 1) ? "true" : "false";
+        out += newline;
+        out += indent;
+        out += "tags: [";
+        append_word(out, 3, 8);
+        out += ", ";
+        append_word(out, 3, 8);
+        out += ']';
+        out += newline;
+    }
+
+    /// @brief Generate block mappings nested 64 levels deep as entries of a sequence.
+    /// @param out The output buffer.
+    /// @param target_size The target size of the output.
+    void generate_deep_nesting(std::string& out, std::size_t target_size) {
+        constexpr std::size_t max_depth = 64;
+        while (out.size() < target_size) {
+            out += "- ";
+            for (std::size_t depth = 0; depth < max_depth; depth++) {
+                // the first key is put right after the block sequence entry prefix.
+                if (depth > 0) {
+                    out.append((depth + 1) * 2, ' ');
+                }
+                out += 'k';
+                out += std::to_string(depth);
+                out += ":\n";
+            }
+            out.append((max_depth + 1) * 2, ' ');
+            out += "leaf: ";
+            append_int(out);
+            out += '\n';
+        }
+    }
+
+    /// @brief Generate a single block mapping with a lot of keys.
+    /// @param out The output buffer.
+    /// @param target_size The target size of the output.
+    void generate_wide_mapping(std::string& out, std::size_t target_size) {
+        std::size_t index = 0;
+        while (out.size() < target_size) {
+            // the index keeps the keys unique.
+            out += "key_";
+            out += std::to_string(index++);
+            out += '_';
+            append_word(out, 2, 6);
+            out += ": ";
+            if (index & 1) {
+                append_word(out, 4, 16);
+            }
+            else {
+                append_int(out);
+            }
+            out += '\n';
+        }
+    }
+
+    /// @brief Generate a mapping of long literal and folded block scalars.
+    /// @param out The output buffer.
+    /// @param target_size The target size of the output.
+    void generate_block_scalars(std::string& out, std::size_t target_size) {
+        std::size_t index = 0;
+        while (out.size() < target_size) {
+            out += "text_";
+            out += std::to_string(index);
+            out += (index & 1) ? ": >\n" : ": |\n";
+            ++index;
+            for (int line = 0; line < 32; line++) {
+                out += "  ";
+                for (int word = 0; word < 10; word++) {
+                    if (word > 0) {
+                        out += ' ';
+                    }
+                    append_word(out, 2, 9);
+                }
+                out += '\n';
+            }
+        }
+    }
+
+    /// @brief Generate a sequence of anchored mappings and aliases to them.
+    /// @param out The output buffer.
+    /// @param target_size The target size of the output.
+    void generate_anchors_aliases(std::string& out, std::size_t target_size) {
+        std::size_t num_anchors = 0;
+        while (out.size() < target_size) {
+            // define a new anchor for every 4 entries, and refer to the defined ones otherwise.
+            if (num_anchors == 0 || next() % 4 == 0) {
+                out += "- &anchor_";
+                out += std::to_string(num_anchors++);
+                out += " {id: ";
+                append_int(out);
+                out += ", name: ";
+                append_word(out, 4, 12);
+                out += "}\n";
+            }
+            else {
+                out += "- *anchor_";
+                out += std::to_string(next() % num_anchors);
+                out += '\n';
+            }
+        }
+    }
+
+    /// @brief Generate a sequence of nested flow sequences and mappings.
+    /// @param out The output buffer.
+    /// @param target_size The target size of the output.
+    void generate_flow_collections(std::string& out, std::size_t target_size) {
+        while (out.size() < target_size) {
+            out += "- {id: ";
+            append_int(out);
+            out += ", values: [";
+            append_float(out);
+            out += ", ";
+            append_float(out);
+            out += ", ";
+            append_float(out);
+            out += "], child: {name: ";
+            append_word(out, 4, 12);
+            out += ", flags: [";
+            out += (next() & 1) ? "true" : "false";
+            out += ", null, ";
+            append_int(out);
+            out += "]}}\n";
+        }
+    }
+
+    /// @brief Generate a block mapping of records.
+    /// @param out The output buffer.
+    /// @param target_size The target size of the output.
+    /// @param newline The line break to be used.
+    void generate_records(std::string& out, std::size_t target_size, const char* newline) {
+        std::size_t index = 0;
+        while (out.size() < target_size) {
+            out += "record_";
+            out += std::to_string(index++);
+            out += ':';
+            out += newline;
+            append_record(out, newline, "  ");
+        }
+    }
+
+private:
+    /// The state of the pseudo random number generator.
+    uint64_t m_state;
+};
+
+} // namespace fkyaml_bm
+
+#endif /* FK_YAML_TOOL_BENCHMARK_WORKLOAD_HPP */
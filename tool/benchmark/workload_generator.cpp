@@ -0,0 +1,58 @@
+//  _______   __ __   __  _____   __  __  __
+// |   __| |_/  |  \_/  |/  _  \ /  \/  \|  |     fkYAML: A C++ header-only YAML library (supporting code)
+// |   __|  _  < \_   _/|  ___  |    _   |  |___  version 0.3.13
+// |__|  |_| \__|  |_|  |_|   |_|___||___|______| https://github.com/fktn-k/fkYAML
+//
+// SPDX-FileCopyrightText: 2023-2024 Kensuke Fukutani <fktn.dev@gmail.com>
+// SPDX-License-Identifier: MIT
+
+#ifdef _MSC_VER
+// suppress the C4996 warning against the usage of fopen().
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "workload.hpp"
+
+static void print_usage(const char* program) {
+    std::fprintf(stderr, "usage: %s <shape> <size> [<output file> [<seed>]]\n", program);
+    std::fprintf(stderr, "  shape: ");
+    for (int i = 0; i < fkyaml_bm::num_workload_shapes; i++) {
+        auto shape = static_cast<fkyaml_bm::workload_shape>(i);
+        std::fprintf(stderr, "%s%s", i > 0 ? ", " : "", fkyaml_bm::to_string(shape));
+    }
+    std::fprintf(stderr, "\n  size:  the approximate output size in bytes");
+    std::fprintf(stderr, " with an optional K, M or G suffix (e.g., 64K)\n");
+    std::fprintf(stderr, "  The output is written to the standard output if no output file is given.\n");
+}
+
+int main(int argc, char** argv) {
+    fkyaml_bm::workload_shape shape {};
+    std::size_t size = 0;
+    if (argc < 3 || !fkyaml_bm::from_string(argv[1], shape) || !fkyaml_bm::parse_size(argv[2], size)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+    if (argc > 4) {
+        seed = std::strtoull(argv[4], nullptr, 0);
+    }
+
+    std::string workload = fkyaml_bm::workload_generator(seed).generate(shape, size);
+
+    FILE* fp = (argc > 3) ? std::fopen(argv[3], "wb") : stdout;
+    if (!fp) {
+        std::fprintf(stderr, "failed to open %s\n", argv[3]);
+        return 1;
+    }
+    std::size_t written = std::fwrite(workload.data(), sizeof(char), workload.size(), fp);
+    if (fp != stdout) {
+        std::fclose(fp);
+    }
+
+    return written == workload.size() ? 0 : 1;
+}